@@ -0,0 +1,316 @@
+#include "Capture.h"
+#ifdef ARDUINO_ARCH_RP2040
+#include "Radio.h"
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+
+// convert I and Q in turn
+static const uint32_t RROBIN_MASK = (1u<<Radio::ADC_QSDI)|(1u<<Radio::ADC_QSDQ);
+
+// the DMA interrupt handler needs to find the capture object
+static Capture *capture_instance = NULL;
+static int32_t capture_dma[Capture::NUM_BLOCKS];
+static uint16_t *capture_block[Capture::NUM_BLOCKS];
+
+// the time the DMA takes to fill a block, the ADC and the
+// timer both run from the crystal so they keep in step
+static const uint32_t CAPTURE_BLOCK_US = Capture::BLOCK_SIZE*1000000ull/Capture::SAMPLE_RATE;
+static_assert(Capture::BLOCK_SIZE*1000000ull%Capture::SAMPLE_RATE==0,"block must be a whole number of us");
+static_assert((Capture::BLOCK_SIZE & (Capture::BLOCK_SIZE-1))==0,"the DMA ring needs a power of 2 block");
+static uint32_t capture_due = 0;
+
+static void __not_in_flash_func(capture_dma_handler)(void)
+{
+  // each channel wraps its write address around its own
+  // block, so it is ready for the next time around however
+  // late this is, one call covers every block that is done
+  bool complete = false;
+  for (uint32_t i=0;i<Capture::NUM_BLOCKS;i++)
+  {
+    const uint32_t ch = capture_dma[i];
+    if (dma_channel_get_irq1_status(ch))
+    {
+      dma_channel_acknowledge_irq1(ch);
+      complete = true;
+    }
+  }
+  if (complete) capture_instance->blockComplete();
+}
+
+static const uint32_t __not_in_flash_func(capture_completed)(const uint32_t filled)
+{
+  // the number of blocks filled, an interrupt held off for
+  // longer than a block stands for more than one of them
+  // the channel that is busy is the block being filled, so
+  // the count modulo the number of blocks, and the timer
+  // says how many times around the blocks the DMA has been
+  uint32_t busy;
+  do
+  {
+    for (busy=0;busy<Capture::NUM_BLOCKS;busy++)
+    {
+      if (dma_channel_is_busy(capture_dma[busy])) break;
+    }
+  }
+  while (busy==Capture::NUM_BLOCKS);
+  const uint32_t late = time_us_32()-capture_due+CAPTURE_BLOCK_US;
+  uint32_t blocks = late/CAPTURE_BLOCK_US;
+  if ((filled+blocks)%Capture::NUM_BLOCKS!=busy)
+  {
+    // the timer and the DMA fall either side of a block end
+    if (late%CAPTURE_BLOCK_US<CAPTURE_BLOCK_US/2 && blocks>1) blocks--;
+    else blocks++;
+  }
+  capture_due += blocks*CAPTURE_BLOCK_US;
+  return filled+blocks;
+}
+
+static const uint16_t *__not_in_flash_func(capture_last)(void)
+{
+  // the sample the DMA wrote last, or NULL in the moment
+  // between one channel finishing and the next starting
+  const uint16_t *const start = capture_block[0];
+  for (uint32_t i=0;i<Capture::NUM_BLOCKS;i++)
+  {
+    if (dma_channel_is_busy(capture_dma[i]))
+    {
+      const uint16_t *last = (const uint16_t *)dma_hw->ch[capture_dma[i]].write_addr-1;
+      // the blocks follow each other in memory
+      if (last<start) last += Capture::NUM_BLOCKS*Capture::BLOCK_SIZE;
+      return last;
+    }
+  }
+  return NULL;
+}
+
+static const uint16_t *__not_in_flash_func(capture_wait)(const uint16_t *last)
+{
+  // wait for the next sample to land, 2us at most
+  const uint16_t *next;
+  do
+  {
+    next = capture_last();
+  }
+  while (next==NULL || next==last);
+  return next;
+}
+#else
+static inline void tight_loop_contents(void) {}
+#endif
+
+Capture::Capture(void)
+{
+  _filled = 0;
+  _consumed = 0;
+  _overruns = 0;
+  _running = false;
+  _aux = 0;
+  _callback = NULL;
+  _callback_context = NULL;
+#ifndef ARDUINO_ARCH_RP2040
+  _source = NULL;
+  _context = NULL;
+  _written = 0;
+#endif
+}
+
+void Capture::begin(void)
+{
+  if (_running) return;
+  _filled = 0;
+  _consumed = 0;
+  _overruns = 0;
+#ifdef ARDUINO_ARCH_RP2040
+  adc_init();
+  adc_gpio_init(Radio::PIN_QSDI);
+  adc_gpio_init(Radio::PIN_QSDQ);
+  adc_gpio_init(Radio::PIN_AGC);
+  adc_select_input(Radio::ADC_QSDI);
+  adc_set_round_robin(RROBIN_MASK);
+  // every sample to the FIFO and request DMA as
+  // soon as there is one sample in the FIFO
+  adc_fifo_setup(true,true,1,false,false);
+  // start a conversion every 96 ADC clocks
+  adc_set_clkdiv(ADC_CLOCK/SAMPLE_RATE-1);
+  adc_fifo_drain();
+
+  // one DMA channel per block, each chained to the next
+  for (uint32_t i=0;i<NUM_BLOCKS;i++)
+  {
+    capture_dma[i] = dma_claim_unused_channel(true);
+    capture_block[i] = _block[i];
+  }
+  for (uint32_t i=0;i<NUM_BLOCKS;i++)
+  {
+    dma_channel_config c = dma_channel_get_default_config(capture_dma[i]);
+    channel_config_set_transfer_data_size(&c,DMA_SIZE_16);
+    channel_config_set_read_increment(&c,false);
+    channel_config_set_write_increment(&c,true);
+    // wrap the write address around the block
+    channel_config_set_ring(&c,true,__builtin_ctz(BLOCK_SIZE*sizeof(uint16_t)));
+    channel_config_set_dreq(&c,DREQ_ADC);
+    channel_config_set_chain_to(&c,capture_dma[(i+1)%NUM_BLOCKS]);
+    dma_channel_configure(capture_dma[i],&c,_block[i],&adc_hw->fifo,BLOCK_SIZE,false);
+    dma_channel_set_irq1_enabled(capture_dma[i],true);
+  }
+  capture_instance = this;
+  // the interrupt is taken on the core that calls begin()
+  irq_add_shared_handler(DMA_IRQ_1,capture_dma_handler,PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(DMA_IRQ_1,true);
+  dma_channel_start(capture_dma[0]);
+  capture_due = time_us_32()+CAPTURE_BLOCK_US;
+  adc_run(true);
+#else
+  _written = 0;
+#endif
+  _running = true;
+}
+
+void Capture::end(void)
+{
+  if (!_running) return;
+#ifdef ARDUINO_ARCH_RP2040
+  adc_run(false);
+  for (uint32_t i=0;i<NUM_BLOCKS;i++)
+  {
+    dma_channel_set_irq1_enabled(capture_dma[i],false);
+    dma_channel_abort(capture_dma[i]);
+  }
+  irq_remove_handler(DMA_IRQ_1,capture_dma_handler);
+  for (uint32_t i=0;i<NUM_BLOCKS;i++)
+  {
+    dma_channel_unclaim(capture_dma[i]);
+  }
+  adc_set_round_robin(0);
+  adc_fifo_setup(false,false,0,false,false);
+  adc_fifo_drain();
+  capture_instance = NULL;
+#endif
+  _running = false;
+}
+
+void Capture::onBlock(callback_t callback, void *context)
+{
+  // the callback runs in the DMA interrupt and has
+  // until the next block completes to finish with it
+  _callback_context = context;
+  _callback = callback;
+}
+
+const uint16_t *Capture::acquire(void)
+{
+  // wait for a block that has not been processed,
+  // if more than one has completed since last time,
+  // the older ones have already been overwritten so
+  // skip to the newest
+#ifndef ARDUINO_ARCH_RP2040
+  if (_filled==_consumed) fill();
+#endif
+  while (_filled==_consumed)
+  {
+    tight_loop_contents();
+  }
+  const uint32_t filled = _filled;
+  if (filled-_consumed>1)
+  {
+    _overruns += filled-_consumed-1;
+    _consumed = filled-1;
+  }
+  return _block[_consumed%NUM_BLOCKS];
+}
+
+const bool Capture::release(void)
+{
+  // the block is intact if the DMA has not
+  // come back around to it while it was in use
+  const bool intact = (_filled-_consumed)<NUM_BLOCKS;
+  if (!intact) _overruns++;
+  _consumed++;
+  return intact;
+}
+
+const uint16_t Capture::readAux(const uint32_t input)
+{
+#ifdef ARDUINO_ARCH_RP2040
+  // take one Q slot of the stream for another input, the
+  // ADC keeps converting every 2us throughout
+  // AINSEL is the input being converted and the round
+  // robin picks the next one as each conversion ends, so
+  // while I converts the round robin is set to I and the
+  // input, which is then converted in place of Q, and while
+  // that converts it goes back to I and Q so I follows as
+  // it would have followed Q
+  // each step has to land within the 2us of a conversion,
+  // so interrupts are off for the three conversions
+  if (!_running) return _aux;
+  const uint32_t status = save_and_disable_interrupts();
+  const uint16_t *slot = capture_wait(capture_last());
+  if (adc_get_selected_input()!=Radio::ADC_QSDI)
+  {
+    slot = capture_wait(slot);
+  }
+  adc_set_round_robin((1u<<Radio::ADC_QSDI)|(1u<<input));
+  slot = capture_wait(slot);
+  adc_set_round_robin(RROBIN_MASK);
+  if (adc_get_selected_input()==input)
+  {
+    // the input lands in the Q slot, which is then given
+    // the Q before it so the spectrum does not see it
+    slot = capture_wait(slot);
+    _aux = *slot & 0x0fffu;
+    const uint16_t *previous = slot-2;
+    if (previous<capture_block[0]) previous += NUM_BLOCKS*BLOCK_SIZE;
+    *(uint16_t *)slot = *previous;
+  }
+  restore_interrupts(status);
+#endif
+  return _aux;
+}
+
+const uint32_t Capture::overruns(void)
+{
+  return _overruns;
+}
+
+void Capture::blockComplete(void)
+{
+  // called (from the DMA interrupt) once one or more blocks
+  // are full, the callback is handed the newest
+#ifdef ARDUINO_ARCH_RP2040
+  _filled = capture_completed(_filled);
+#else
+  _filled = _written/BLOCK_SIZE;
+#endif
+  if (_callback)
+  {
+    _callback(_block[(_filled-1)%NUM_BLOCKS],_callback_context);
+  }
+}
+
+#ifndef ARDUINO_ARCH_RP2040
+void Capture::setSource(source_t source, void *context)
+{
+  _source = source;
+  _context = context;
+}
+
+void Capture::fill(const bool interrupt)
+{
+  // do what the DMA would do, fill the next block in turn,
+  // the interrupt can be left out as if it were held off
+  uint16_t *block = _block[(_written/BLOCK_SIZE)%NUM_BLOCKS];
+  if (_source)
+  {
+    _source(block,BLOCK_SIZE,_context);
+  }
+  else
+  {
+    for (uint32_t i=0;i<BLOCK_SIZE;i++) block[i] = 2048u;
+  }
+  _written += BLOCK_SIZE;
+  if (interrupt) blockComplete();
+}
+#endif
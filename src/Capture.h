@@ -0,0 +1,77 @@
+/*
+  Free running capture of the QSD I and Q channels.
+
+  The ADC runs in round robin over GP26 (I) and GP27 (Q) so
+  the samples alternate I,Q,I,Q... at exactly SAMPLE_RATE
+  (250KHz per channel). The ADC FIFO feeds two DMA channels
+  that are chained to each other, each one filling its own
+  block, so sampling never stops while a completed block is
+  being processed (ping-pong). Each channel wraps its write
+  address around its own block in hardware, so the blocks
+  are aligned to their size, which can leave a gap in front
+  of the object that holds them.
+
+  Completed blocks are either handed to a callback from the
+  DMA interrupt as soon as they land, or taken in turn with
+  acquire() and release().
+
+  The number of blocks filled is worked out from the DMA and
+  the timer, not by counting interrupts, so an interrupt
+  that is held off for longer than a block (flash writes)
+  still counts every block, and the callback is handed the
+  newest.
+
+  readAux() reads another ADC input without stopping the
+  stream, the reading takes the place of one Q sample, which
+  is filled in with the Q sample before it.
+
+  Built for anything other than the RP2040 the DMA and ADC are
+  replaced by a sample source callback, so the block rotation
+  can be exercised on a host.
+*/
+#ifndef Capture_h
+#define Capture_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+class Capture
+{
+  public:
+    static const uint32_t ADC_CLOCK = 48000000ul;  // ADC clock (USB PLL)
+    static const uint32_t SAMPLE_RATE = 500000ul;  // both channels, interleaved
+    static const uint32_t BLOCK_SIZE = 1024u;      // samples per block (512 I/Q pairs)
+    static const uint32_t NUM_BLOCKS = 2u;         // ping-pong
+    typedef void (*callback_t)(const uint16_t *block, void *context);
+    Capture(void);
+    void begin(void);
+    void end(void);
+    void onBlock(callback_t callback, void *context);
+    const uint16_t *acquire(void);
+    const bool release(void);
+    const uint16_t __attribute__((noinline,long_call,section(".time_critical"))) readAux(const uint32_t input);
+    const uint32_t overruns(void);
+    void blockComplete(void);
+#ifndef ARDUINO_ARCH_RP2040
+    // host stand-in for the ADC and DMA
+    typedef void (*source_t)(uint16_t *block, const uint32_t count, void *context);
+    void setSource(source_t source, void *context);
+    void fill(const bool interrupt = true);
+#endif
+  private:
+    uint16_t _block[NUM_BLOCKS][BLOCK_SIZE] __attribute__((aligned(BLOCK_SIZE*sizeof(uint16_t))));
+    volatile uint32_t _filled;
+    uint32_t _consumed;
+    uint32_t _overruns;
+    bool _running;
+    uint16_t _aux;
+    callback_t _callback;
+    void *_callback_context;
+#ifndef ARDUINO_ARCH_RP2040
+    source_t _source;
+    void *_context;
+    uint32_t _written;
+#endif
+};
+
+#endif
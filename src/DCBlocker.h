@@ -0,0 +1,73 @@
+/*
+  Single pole DC blocker for a stream of fixed-point samples.
+
+  The DC estimate follows the input through a one pole low
+  pass filter with a coefficient of 2^-shift and is subtracted
+  from each sample, which gives a high pass response with a
+  corner of about sample_rate/(2*pi*2^shift). The state is kept
+  between calls so there is no step at block or frame edges.
+
+  Samples up to 16 bits, the estimate is held with 12 bits of
+  fraction in 32 bits.
+*/
+#ifndef DCBlocker_h
+#define DCBlocker_h
+
+#include <stdint.h>
+
+class DCBlocker
+{
+  public:
+    DCBlocker(void)
+    {
+      _dc = 0;
+      _shift = 10;
+    }
+
+    void setCorner(const uint32_t corner, const uint32_t sample_rate)
+    {
+      // pick the shift whose corner is nearest the one asked for
+      uint32_t best = 1;
+      uint32_t best_error = UINT32_MAX;
+      for (uint32_t shift=1;shift<=MAX_SHIFT;shift++)
+      {
+        const uint32_t f = cornerOf(shift,sample_rate);
+        const uint32_t error = f>corner?f-corner:corner-f;
+        if (error<best_error)
+        {
+          best_error = error;
+          best = shift;
+        }
+      }
+      _shift = best;
+    }
+
+    const uint32_t corner(const uint32_t sample_rate)
+    {
+      return cornerOf(_shift,sample_rate);
+    }
+
+    void reset(void)
+    {
+      _dc = 0;
+    }
+
+    inline int32_t process(const int32_t x)
+    {
+      _dc += (x*(1 << FRAC)-_dc) >> _shift;
+      return x-((_dc+(1 << (FRAC-1))) >> FRAC);
+    }
+
+  private:
+    static const uint32_t FRAC = 12;
+    static const uint32_t MAX_SHIFT = 15;
+    static const uint32_t cornerOf(const uint32_t shift, const uint32_t sample_rate)
+    {
+      // sample_rate / (2 * pi * 2^shift)
+      return (uint32_t)(((uint64_t)sample_rate*1000ull/6283ull) >> shift);
+    }
+    int32_t _dc;
+    uint32_t _shift;
+};
+
+#endif
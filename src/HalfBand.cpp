@@ -0,0 +1,34 @@
+#include "HalfBand.h"
+#include <string.h>
+
+HalfBand::HalfBand(void)
+{
+  reset();
+}
+
+void HalfBand::reset(void)
+{
+  memset(_i,0,sizeof(_i));
+  memset(_q,0,sizeof(_q));
+}
+
+void HalfBand::load(const uint16_t *block)
+{
+  // split a capture block into I and Q behind the
+  // history and convert to signed values
+  int16_t *i = &_i[HISTORY];
+  int16_t *q = &_q[HISTORY];
+  for (uint32_t n=0;n<PAIRS;n++)
+  {
+    i[n] = (int16_t)(block[0]-2048);
+    q[n] = (int16_t)(block[1]-2048);
+    block += 2;
+  }
+}
+
+void HalfBand::next(void)
+{
+  // the end of this block is the history for the next
+  memcpy(_i,&_i[PAIRS],HISTORY*sizeof(_i[0]));
+  memcpy(_q,&_q[PAIRS],HISTORY*sizeof(_q[0]));
+}
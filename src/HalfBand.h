@@ -0,0 +1,94 @@
+/*
+  Half-band decimation by 2 of the interleaved QSD I/Q samples.
+
+  The ADC takes I and Q in turn, so each Q sample lands half
+  way between two I samples. Both channels are filtered with
+  the two polyphase branches of one quarter-band prototype at
+  the 500KHz interleaved rate, which puts the I and Q outputs
+  at the same instant with matched responses:
+
+  - I uses the even branch, a 27 tap half-band filter, every
+    other tap is zero and is skipped
+  - Q uses the odd branch, 26 taps
+
+  Both are symmetric so each coefficient multiplies the sum
+  of a pair of samples. Pass band to 50KHz (-0.36dB), -3dB
+  at 58KHz, -6dB at 62.5KHz, -10dB at 66KHz, -16dB at 70KHz,
+  -28dB at 75KHz and better than 50dB from 80KHz.
+
+  A signal at 125KHz-f folds onto offset f, so the display
+  stops at +/-44KHz (3 bins a pixel at zoom 0), where what
+  folds is already down by 50dB. The last 15KHz below the
+  output rate would only be 10 to 40dB down.
+
+  Gain is 4 (12 bit samples in, 14 bit samples out), same as
+  the pair sum it replaced. 32 bit accumulators are plenty,
+  coefficients are scaled to 2^15 per branch.
+*/
+#ifndef HalfBand_h
+#define HalfBand_h
+
+#include <stdint.h>
+#include "Capture.h"
+
+class HalfBand
+{
+  public:
+    // samples either side of the centre tap
+    static const uint32_t REACH = 13u;
+    // samples kept from one block to the next
+    static const uint32_t HISTORY = REACH*2;
+    // I/Q pairs per capture block
+    static const uint32_t PAIRS = Capture::BLOCK_SIZE/2;
+    HalfBand(void);
+    void reset(void);
+    void __attribute__((noinline,long_call,section(".time_critical"))) load(const uint16_t *block);
+    void next(void);
+
+    // the half-band filter on its own, centred on x[0], the
+    // result is 2^15 times the input (coefficients sum)
+    static inline int32_t filter(const int16_t *x)
+    {
+      int32_t acc = (int32_t)x[0] << 14;
+      acc += (x[-1]+x[1])*10265;
+      acc -= (x[-3]+x[3])*3000;
+      acc += (x[-5]+x[5])*1372;
+      acc -= (x[-7]+x[7])*635;
+      acc += (x[-9]+x[9])*259;
+      acc -= (x[-11]+x[11])*81;
+      acc += (x[-13]+x[13])*12;
+      return acc;
+    }
+
+    // decimated output n (0 to PAIRS/2-1) of the loaded block
+    inline int32_t I(const uint32_t n)
+    {
+      return filter(&_i[REACH+n*2]) >> 13;
+    }
+
+    inline int32_t Q(const uint32_t n)
+    {
+      const int16_t *x = &_q[REACH+n*2];
+      int32_t acc = (x[-1]+x[0])*14697;
+      acc += (x[-2]+x[1])*4742;
+      acc -= (x[-3]+x[2])*2665;
+      acc -= (x[-4]+x[3])*1723;
+      acc += (x[-5]+x[4])*1170;
+      acc += (x[-6]+x[5])*804;
+      acc -= (x[-7]+x[6])*548;
+      acc -= (x[-8]+x[7])*365;
+      acc += (x[-9]+x[8])*234;
+      acc += (x[-10]+x[9])*142;
+      acc -= (x[-11]+x[10])*80;
+      acc -= (x[-12]+x[11])*40;
+      acc += (x[-13]+x[12])*16;
+      return acc >> 13;
+    }
+
+  private:
+    // history followed by the block being filtered
+    int16_t _i[HISTORY+PAIRS];
+    int16_t _q[HISTORY+PAIRS];
+};
+
+#endif
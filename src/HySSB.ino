@@ -28,7 +28,6 @@
  *   lock LCK: (lock, unlock)
  *   attenuator: (ATT)
  *   TODO: spectrum options (width, speed (averaging)) SPE WAT SPM
- *   TODO: measure speed of FFT/ADC
  *   
 */
 
@@ -72,9 +71,14 @@
 #define POS_TUNING_STEP_Y  40
 #define POS_WATER_X         0
 #define POS_WATER_Y        62
+#define POS_WATERFALL_Y    94
 #define POS_CENTER_LEFT   119
 #define POS_CENTER_RIGHT  120
 #define BANDWIDTH_SHADE 0x0010
+#define STATUS_INTERVAL    20UL
+#define SCOPE_INTERVAL     20UL
+#define DISPLAY_JOBS       16
+#define STRIP_LINES         8
 
 // radio state
 enum state_t
@@ -108,6 +112,78 @@ enum state_t
   STATE_STEP_WAIT
 };
 
+// status panel widgets above the scope
+enum widget_t
+{
+  WIDGET_RXTX,
+  WIDGET_FREQUENCY,
+  WIDGET_STEP,
+  WIDGET_MODE,
+  WIDGET_METER,
+  WIDGET_MULTI,
+  WIDGET_ATT,
+  WIDGET_COUNT
+};
+
+struct rect_t
+{
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+// a rectangle for the display DMA, either pixels in the
+// byte order the display takes, or NULL for the same place
+// in the sprite
+struct display_job_t
+{
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+  const uint16_t *pixels;
+};
+
+// the sprite is 4 bit, what is drawn on it are indices
+// into sprite_palette, SPRITE_SPLASH changes colour for
+// the splash screen
+enum sprite_color_t
+{
+  SPRITE_BLACK,
+  SPRITE_WHITE,
+  SPRITE_RED,
+  SPRITE_GREEN,
+  SPRITE_PURPLE,
+  SPRITE_SHADE,
+  SPRITE_SPLASH
+};
+
+static const uint16_t sprite_palette[16] =
+{
+  TFT_BLACK,
+  TFT_WHITE,
+  TFT_RED,
+  TFT_GREEN,
+  TFT_PURPLE,
+  BANDWIDTH_SHADE,
+  TFT_WHITE
+};
+
+// what each widget draws over, text size 1 is 6x8
+// pixels a character, 2 is 12x16, 3 is 18x24, each
+// sized for the widest thing the widget can show
+static const rect_t widget_rect[WIDGET_COUNT] =
+{
+  {POS_TX_X,POS_TX_Y,POS_RX_X+24-POS_TX_X,16},       // "TX" and "RX"
+  {POS_FREQUENCY_X,POS_FREQUENCY_Y,8*18,24},         // 8 digits, padded below 10MHz
+  {POS_TUNING_STEP_X-30,POS_TUNING_STEP_Y,30+6*6,8}, // "STEP" and up to 100000
+  {POS_MODE_X-5,POS_MODE_Y-5,45,25},                 // 3 letters in a filled box
+  {POS_METER_X,POS_METER_Y,13*6,12},                 // the scale and 15 bars under it
+  {POS_MULTI_X-4,POS_MULTI_Y-5,45,25},               // 3 letters in a filled box
+  {POS_ATT_X-5,POS_ATT_Y-5,45,25}                    // "ATT", the WPM or VERSION in a filled box
+};
+
 enum func_state_t
 {
   FUNCTION_STATE_IDLE,
@@ -175,7 +251,13 @@ enum scopeoption_t
   SCOPE_SPEED_4,
   SCOPE_ZOOM_0,
   SCOPE_ZOOM_1,
-  SCOPE_ZOOM_2
+  SCOPE_ZOOM_2,
+  SCOPE_ZOOM_3,
+  SCOPE_ZOOM_4,
+  SCOPE_ZOOM_5,
+  SCOPE_OVERLAP_0,
+  SCOPE_OVERLAP_50,
+  SCOPE_OVERLAP_75
 };
 
 enum messages_t
@@ -282,10 +364,37 @@ static state_t radio_state = STATE_LSB_RECEIVE_INIT;
 static state_t saved_state = STATE_NO_STATE;
 static state_t next_state = STATE_NO_STATE;
 static struct repeating_timer radio_timer;
-static uint8_t spectrum_data[N_WAVE];
-static uint8_t spectrum_buffer[N_WAVE];
+static const uint8_t *spectrum_buffer = NULL;
+// the waterfall is a ring of rows already coloured and in
+// the byte order the display takes, newest at wp, each row
+// in memory is the one above the next on the display
 volatile static uint32_t wp = 0;
-static uint8_t water[WATERFALL_ROWS][WIDTH] = {0};
+static uint16_t water[WATERFALL_ROWS][WIDTH] = {0};
+// the newest row on the 32 pixel trace scale
+static uint8_t trace[WIDTH] = {0};
+// display transfers waiting for the DMA, a pass of the
+// scope and status panel queues at most 10
+static display_job_t display_jobs[DISPLAY_JOBS];
+static uint32_t display_head = 0;
+static uint32_t display_tail = 0;
+// the sprite palette in the byte order the display takes
+static uint16_t display_palette[16];
+// rectangles of the sprite are expanded out a strip at a
+// time, one strip is filled while the other is sent
+static uint16_t display_strip[2][STRIP_LINES*WIDTH];
+static uint32_t display_next_strip = 0;
+static display_job_t display_staged;
+static boolean display_is_staged = false;
+#ifdef SPECTRUM_LATENCY
+// core 0 time spent drawing and feeding the display since
+// the last new row landed
+static uint32_t display_busy_us = 0;
+#define DISPLAY_BUSY_MARK(t) const uint32_t t = time_us_32()
+#define DISPLAY_BUSY_ADD(t) display_busy_us += time_us_32()-(t)
+#else
+#define DISPLAY_BUSY_MARK(t)
+#define DISPLAY_BUSY_ADD(t)
+#endif
 
 static multifunc_t multifunc =
 {
@@ -324,7 +433,38 @@ static band_save_t band_save[Radio::NUM_BANDS] =
   {28480000UL, 1000UL, Radio::USB, ATTN_OFF}
 };
 
-auto_init_mutex(spectrum_mutex);
+// passband of each filter in Hz for the scope shading,
+// receiving shades this much on the side of the sideband,
+// transmitting half as much either side of the centre, the
+// zoom FFT is centred on the middle of it
+static const uint32_t passband_hz[] =
+{
+  0,     // FILTER_XXX
+  2500,  // FILTER_SSB
+  1500,  // FILTER_CW
+  3500   // FILTER_DIG
+};
+
+static const Radio::filter_t mode_filter[] =
+{
+  Radio::FILTER_XXX,  // XXX
+  Radio::FILTER_SSB,  // LSB
+  Radio::FILTER_SSB,  // USB
+  Radio::FILTER_CW,   // CWL
+  Radio::FILTER_CW,   // CWU
+  Radio::FILTER_DIG,  // DIGL
+  Radio::FILTER_DIG   // DIGU
+};
+
+// gain of the attenuator in dB, taken off the spectrum so
+// its dB scale stays referred to the antenna
+static const int32_t ATTENUATOR_GAIN = -18;
+
+// auto contrast of the spectrum and waterfall in steps of
+// spectrum.mag[] (about 0.28dB), how far below the noise
+// floor to start and the least span to show
+static const int32_t CONTRAST_MARGIN = 10;
+static const int32_t CONTRAST_MIN = 70;
 
 const uint32_t FREQUENCY = 7105000UL;         // The starting frequency in Hz
 const uint32_t STEP = 1000UL;                 // The starting tuning step in Hz
@@ -332,7 +472,7 @@ const Si5351A::modes_t MODE = Si5351A::LSB;   // The starting mode
 const uint32_t CORRECTION = 0;                // Using TCXO
 
 Radio radio(FREQUENCY,STEP,Radio::LSB,Radio::BAND40); // object to abstract radio hardware
-Spectrum spectrum;                            // calculate the frequency spectrum (runs on core 1)
+Spectrum<SPECTRUM_POINTS> spectrum;           // calculate the frequency spectrum (runs on core 1)
 Si5351A si5351A;                              // Create a Si5351 object and set the frequency correction
 
 // TFT control object
@@ -371,6 +511,7 @@ static void save_settings(void)
   EEPROM.write(0,(uint8_t)radio.scope_speed);
   EEPROM.write(1,(uint8_t)radio.scope_zoom);
   EEPROM.write(2,(uint8_t)cw_dit);
+  EEPROM.write(3,(uint8_t)radio.scope_overlap);
   EEPROM.commit();
   EEPROM.end();
 }
@@ -381,11 +522,12 @@ static void restore_settings(void)
   radio.scope_speed = EEPROM.read(0);
   radio.scope_zoom = EEPROM.read(1);
   cw_dit = EEPROM.read(2);
+  radio.scope_overlap = EEPROM.read(3);
   EEPROM.end();
   if (radio.scope_speed<0 ||
     radio.scope_speed>8 ||
     radio.scope_zoom<0 ||
-    radio.scope_zoom>3 ||
+    radio.scope_zoom>spectrum.MAX_ZOOM ||
     cw_dit<40 ||
     cw_dit>120)
   {
@@ -393,6 +535,12 @@ static void restore_settings(void)
     radio.scope_zoom = 0;
     cw_dit = CW_SPEED_DEFAULT;
   }
+  if (radio.scope_overlap!=0 &&
+    radio.scope_overlap!=50 &&
+    radio.scope_overlap!=75)
+  {
+    radio.scope_overlap = 0;
+  }
 }
 
 void setup(void)
@@ -413,6 +561,9 @@ void setup(void)
 
   radio.init();
   restore_settings();
+#if defined(SPECTRUM_LATENCY) || defined(SPECTRUM_PROFILE)
+  Serial.begin();
+#endif
 
   if (!add_repeating_timer_us(-1000LL, process_radio_callback, NULL, &radio_timer))
   {
@@ -427,32 +578,61 @@ void setup(void)
   tft.setRotation(1);
   tft.fillScreen(TFT_BLACK);
 
-  // Optionally set colour depth to 8 or 16 bits, default is 16 if not specified
-  // spr.setColorDepth(8);
-
-  // Create a sprite of defined size
-  spr.createSprite(WIDTH,HEIGHT);
-  spr.fillSprite(TFT_BLACK);
+  // the sprite covers the status panel and the spectrum
+  // trace, the waterfall below it goes straight to the
+  // display already in its byte order, 4 bit colour is
+  // 11KB rather than 45KB at 16 bit
+  spr.setColorDepth(4);
+  if (spr.createSprite(WIDTH,POS_WATERFALL_Y)==NULL)
+  {
+    error_stop(8U);
+  }
+  spr.createPalette(sprite_palette);
+  for (uint32_t i=0;i<16;i++)
+  {
+    display_palette[i] = __builtin_bswap16(sprite_palette[i]);
+  }
+  spr.fillSprite(SPRITE_BLACK);
   spr.pushSprite(0,0);
   delay(2000);
   spr.setTextSize(3);
   for (uint32_t i=0;i<16;i++)
   {
-    spr.fillSprite(TFT_BLACK);
-    spr.setTextColor(color_map_16[i],TFT_BLACK);
+    spr.fillSprite(SPRITE_BLACK);
+    spr.setPaletteColor(SPRITE_SPLASH,color_map_16[i]);
+    spr.setTextColor(SPRITE_SPLASH,SPRITE_BLACK);
     spr.setCursor(POS_SPLASH_X,POS_SPLASH_Y);
     spr.print(CALL_SIGN);
     spr.pushSprite(0,0);
     delay(200);
   }
-  spr.fillSprite(TFT_BLACK);
+  spr.fillSprite(SPRITE_BLACK);
   spr.pushSprite(0,0);
+
+  // from here everything goes to the display by DMA, the
+  // display is alone on its SPI so it keeps it throughout
+  if (!tft.initDMA())
+  {
+    error_stop(7U);
+  }
+  tft.startWrite();
+}
+
+void setup1(void)
+{
+#ifdef SPECTRUM_BENCHMARK
+  Serial.begin();
+  while (!Serial) delay(10);
+  spectrum_benchmark(Serial);
+#endif
+  // the spectrum capture interrupts are handled by core 1
+  spectrum.begin();
 }
 
 static void show_frequency(void)
 {
   spr.setTextSize(3);
-  spr.setTextColor(radio.isLocked()?TFT_RED:TFT_WHITE,TFT_BLACK);
+  spr.setTextColor(radio.isLocked()?SPRITE_RED:SPRITE_WHITE,SPRITE_BLACK);
   spr.setCursor(POS_FREQUENCY_X,POS_FREQUENCY_Y);
   if (radio.frequency<10000000UL) spr.print(" ");
   if (radio.frequency<1000000UL) spr.print(" ");
@@ -463,10 +643,10 @@ static void show_tuning_step(void)
 {
   spr.setTextSize(1);
   spr.setCursor(POS_TUNING_STEP_X-30,POS_TUNING_STEP_Y);
-  spr.setTextColor(TFT_WHITE);
+  spr.setTextColor(SPRITE_WHITE);
   spr.print("STEP");
   spr.setCursor(POS_TUNING_STEP_X,POS_TUNING_STEP_Y);
-  spr.setTextColor(TFT_WHITE);
+  spr.setTextColor(SPRITE_WHITE);
   spr.print(radio.tuning_step);
 }
 
@@ -474,10 +654,10 @@ static void show_tx(void)
 {
   spr.setTextSize(2);
   spr.setCursor(POS_TX_X,POS_TX_Y);
-  spr.setTextColor(TFT_WHITE);
+  spr.setTextColor(SPRITE_WHITE);
   spr.print("TX");
   spr.setCursor(POS_RX_X,POS_RX_Y);
-  spr.setTextColor(TFT_RED);
+  spr.setTextColor(SPRITE_RED);
   spr.print("RX");
 }
 
@@ -485,10 +665,10 @@ static void show_rx(void)
 {
   spr.setTextSize(2);
   spr.setCursor(POS_TX_X,POS_TX_Y);
-  spr.setTextColor(TFT_RED);
+  spr.setTextColor(SPRITE_RED);
   spr.print("TX");
   spr.setCursor(POS_RX_X,POS_RX_Y);
-  spr.setTextColor(TFT_WHITE);
+  spr.setTextColor(SPRITE_WHITE);
   spr.print("RX");
 }
 
@@ -506,9 +686,9 @@ static void show_rx_tx(void)
 
 static void show_mode()
 {
-  spr.fillRect(POS_MODE_X-5,POS_MODE_Y-5,45,25,TFT_WHITE);
+  spr.fillRect(POS_MODE_X-5,POS_MODE_Y-5,45,25,SPRITE_WHITE);
   spr.setTextSize(2);
-  spr.setTextColor(TFT_BLACK);
+  spr.setTextColor(SPRITE_BLACK);
   spr.setCursor(POS_MODE_X,POS_MODE_Y);
   const char *sz_mode = "XXX";
   switch (radio.mode)
@@ -523,21 +703,26 @@ static void show_mode()
   spr.print(sz_mode);
 }
 
-static void show_meter_dial(void)
+static const uint32_t meter_value(void)
 {
   uint32_t v = spectrum.AGC;
   if (radio.attEnabled() && v>0)
   {
     v += 3;
   }
-  v = min(v,15);
+  return min(v,15);
+}
+
+static void show_meter_dial(void)
+{
+  const uint32_t v = meter_value();
   spr.setTextSize(1);
   spr.setCursor(POS_METER_X,POS_METER_Y);
-  spr.setTextColor(TFT_WHITE);
+  spr.setTextColor(SPRITE_WHITE);
   spr.print("1 3 5 7 9 +20");
   for (uint32_t i=0;i<v;i++)
   {
-    spr.fillRect(POS_METER_X+i*5+0,POS_METER_Y+8,4,4,TFT_WHITE);
+    spr.fillRect(POS_METER_X+i*5+0,POS_METER_Y+8,4,4,SPRITE_WHITE);
   }
 }
 
@@ -545,17 +730,17 @@ static void show_attenuator(void)
 {
   if (radio.attEnabled())
   {
-    spr.fillRect(POS_ATT_X-5,POS_ATT_Y-5,45,25,TFT_GREEN);
+    spr.fillRect(POS_ATT_X-5,POS_ATT_Y-5,45,25,SPRITE_GREEN);
     spr.setTextSize(2);
-    spr.setTextColor(TFT_BLACK);
+    spr.setTextColor(SPRITE_BLACK);
     spr.setCursor(POS_ATT_X,POS_ATT_Y);
     spr.print("ATT");
   }
   else if (radio.mode==Radio::CWL || radio.mode==Radio::CWU)
   {
-    spr.fillRect(POS_ATT_X-5,POS_ATT_Y-5,45,25,TFT_PURPLE);
+    spr.fillRect(POS_ATT_X-5,POS_ATT_Y-5,45,25,SPRITE_PURPLE);
     spr.setTextSize(2);
-    spr.setTextColor(TFT_WHITE);
+    spr.setTextColor(SPRITE_WHITE);
     spr.setCursor(POS_ATT_X,POS_ATT_Y);
     switch (multifunc.current_value_wpm)
     {
@@ -584,483 +769,283 @@ static void show_attenuator(void)
   }
   else
   {
-    spr.fillRect(POS_ATT_X-5,POS_ATT_Y-5,45,25,TFT_PURPLE);
+    spr.fillRect(POS_ATT_X-5,POS_ATT_Y-5,45,25,SPRITE_PURPLE);
     spr.setTextSize(2);
-    spr.setTextColor(TFT_WHITE);
+    spr.setTextColor(SPRITE_WHITE);
     spr.setCursor(POS_ATT_X,POS_ATT_Y);
     spr.print(VERSION);
   }
 }
 
+static const int32_t zoom_shift(void)
+{
+  // Hz the middle of the scope is above the tuned
+  // frequency, the zoom FFT levels are centred on the
+  // middle of the passband so it fills the span
+  if (radio.scope_zoom<3) return 0;
+  const int32_t half = passband_hz[mode_filter[radio.mode]]/2;
+  const boolean upper = radio.mode==Radio::USB || radio.mode==Radio::CWU || radio.mode==Radio::DIGU;
+  return upper ? half : -half;
+}
+
+static void set_zoom_offset(void)
+{
+  // only when the mode or the zoom changes, positive I/Q
+  // frequencies are shown left of the centre (below the
+  // tuned frequency), so the offset is the other way round
+  static uint32_t shown = UINT32_MAX;
+  const uint32_t key = radio.mode | (radio.scope_zoom << 4);
+  if (key==shown) return;
+  shown = key;
+  spectrum.setZoomOffset(-zoom_shift());
+}
+
+static void format_offset(char *text, const size_t size, const int32_t hz)
+{
+  // signed Hz from the tuned frequency, whole KHz from 10KHz,
+  // tenths of a KHz from 1KHz, Hz below that
+  const char sign = hz<0 ? '-' : '+';
+  const unsigned long a = hz<0 ? -hz : hz;
+  if (a>=10000ul) snprintf(text,size,"%c%luKHz",sign,(a+500ul)/1000ul);
+  else if (a>=1000ul) snprintf(text,size,"%c%lu.%luKHz",sign,(a+50ul)/1000ul,((a+50ul)/100ul)%10ul);
+  else snprintf(text,size,"%c%luHz",sign,a);
+}
+
 static void show_bandwidth(void)
 {
-  spr.setTextSize(1);
-  spr.setTextColor(TFT_WHITE);
-  switch (radio.scope_zoom)
+  // the shading and the span labels only change with the
+  // mode, the zoom and TX, they are worked out again then
+  static uint32_t shown = UINT32_MAX;
+  static int32_t left = 0;
+  static int32_t right = 0;
+  static char label_low[12];
+  static char label_high[12];
+  const uint32_t key = radio.mode | (radio.scope_zoom << 4) | (radio.txEnabled()?0x100UL:0UL);
+  if (key!=shown)
   {
-    case 0:
+    shown = key;
+    const uint32_t zoom = radio.scope_zoom;
+    const int32_t hz = passband_hz[mode_filter[radio.mode]];
+    const int32_t shift = zoom_shift();
+    int32_t low, high; // Hz from the centre of the scope
+    if (radio.txEnabled() && shift==0)
     {
-      // for 60KHz scope 250Hz / pixel
-      spr.setCursor(0,POS_WATER_Y+4);
-      spr.print("-30KHz");
-      spr.setCursor(WIDTH-40,POS_WATER_Y+4);
-      spr.print("+30KHz");
-      break;
+      // transmitting, half the passband either side
+      low = -hz/2;
+      high = hz/2;
     }
-    case 1:
+    else
     {
-      // for 30KHz scope 125Hz / pixel
-      spr.setCursor(0,POS_WATER_Y+4);
-      spr.print("-15KHz");
-      spr.setCursor(WIDTH-40,POS_WATER_Y+4);
-      spr.print("+15KHz");
-      break;
-    }
-    case 2:
-    {
-      // for 15KHz scope 63Hz / pixel
-      spr.setCursor(0,POS_WATER_Y+4);
-      spr.print("-8KHz");
-      spr.setCursor(WIDTH-34,POS_WATER_Y+4);
-      spr.print("+8KHz");
-      break;
+      // the passband on the side of the sideband, the zoom
+      // FFT levels have it in the middle
+      const boolean upper = radio.mode==Radio::USB || radio.mode==Radio::CWU || radio.mode==Radio::DIGU;
+      low = upper ? -shift : -shift-hz;
+      high = low+hz;
     }
+    // positive offsets are right of POS_CENTER_RIGHT
+    left = low<0 ? spectrum.hzToPixels(-low,zoom) : 0;
+    right = high>0 ? spectrum.hzToPixels(high,zoom) : 0;
+    if (left>WIDTH/2) left = WIDTH/2;
+    if (right>WIDTH/2) right = WIDTH/2;
+
+    // the ends of the span from the tuned frequency
+    const int32_t half = spectrum.displaySpan(zoom)/2;
+    format_offset(label_low,sizeof(label_low),shift-half);
+    format_offset(label_high,sizeof(label_high),shift+half);
   }
-  if (radio.txEnabled())
+
+  // left of POS_CENTER_LEFT and right of POS_CENTER_RIGHT
+  if (left>0) spr.fillRect(POS_CENTER_LEFT+1-left,POS_WATER_Y,left,32,SPRITE_SHADE);
+  if (right>0) spr.fillRect(POS_CENTER_RIGHT,POS_WATER_Y,right,32,SPRITE_SHADE);
+
+  spr.setTextSize(1);
+  spr.setTextColor(SPRITE_WHITE);
+  spr.setCursor(0,POS_WATER_Y+4);
+  spr.print(label_low);
+  spr.setCursor(WIDTH-4-strlen(label_high)*6,POS_WATER_Y+4);
+  spr.print(label_high);
+}
+
+static void display_queue(const int16_t x, const int16_t y, const int16_t w, const int16_t h, const uint16_t *pixels)
+{
+  // nothing new is drawn while jobs are waiting so the
+  // queue does not fill, a job that would not fit is dropped
+  if (w<=0 || h<=0 || display_tail-display_head>=DISPLAY_JOBS)
   {
-    switch (radio.scope_zoom)
-    {
-      case 0:
-      {
-        // for 60KHz scope 250Hz / pixel
-        switch (radio.mode)
-        {
-          case Radio::LSB:
-          case Radio::USB:
-          {
-            for (uint32_t x=0;x<5;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::CWL:
-          case Radio::CWU:
-          {
-            for (uint32_t x=0;x<3;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::DIGL:
-          case Radio::DIGU:
-          {
-            for (uint32_t x=0;x<7;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-        }
-        break;      
-      }
-      case 1:
-      {
-        // for 30KHz scope 125Hz / pixel
-        switch (radio.mode)
-        {
-          case Radio::LSB:
-          case Radio::USB:
-          {
-            for (uint32_t x=0;x<10;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::CWL:
-          case Radio::CWU:
-          {
-            for (uint32_t x=0;x<6;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::DIGL:
-          case Radio::DIGU:
-          {
-            for (uint32_t x=0;x<14;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-        }
-        break;      
-      }
-      case 2:
-      {
-        // for 15KHz scope 63Hz / pixel
-        switch (radio.mode)
-        {
-          case Radio::LSB:
-          case Radio::USB:
-          {
-            for (uint32_t x=0;x<20;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::CWL:
-          case Radio::CWU:
-          {
-            for (uint32_t x=0;x<10;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::DIGL:
-          case Radio::DIGU:
-          {
-            for (uint32_t x=0;x<25;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-        }
-        break;      
-      }
-    }
+    return;
+  }
+  display_jobs[display_tail%DISPLAY_JOBS] = {x,y,w,h,pixels};
+  display_tail++;
+}
+
+static void display_queue_sprite(const rect_t &r)
+{
+  display_queue(r.x,r.y,r.w,r.h,NULL);
+}
+
+static void display_expand(uint16_t *out, const int16_t x, const int16_t y, const int16_t w)
+{
+  // a line of the 4 bit sprite to display colours, two
+  // pixels a byte, the left one in the high nibble
+  const uint8_t *in = (const uint8_t *)spr.getPointer()+y*(WIDTH/2)+(x>>1);
+  const uint16_t *const end = out+w;
+  if (x & 1)
+  {
+    *out++ = display_palette[*in++ & 0x0f];
+  }
+  while (out+1<end)
+  {
+    const uint8_t pair = *in++;
+    *out++ = display_palette[pair >> 4];
+    *out++ = display_palette[pair & 0x0f];
+  }
+  if (out<end)
+  {
+    *out = display_palette[*in >> 4];
+  }
+}
+
+static void display_stage(void)
+{
+  // the next transfer, pixels go as they are, the sprite
+  // is expanded into a strip a few lines at a time
+  if (display_is_staged || display_head==display_tail)
+  {
+    return;
+  }
+  display_job_t &job = display_jobs[display_head%DISPLAY_JOBS];
+  if (job.pixels!=NULL)
+  {
+    display_staged = job;
+    display_head++;
   }
   else
   {
-    // receiving
-    switch (radio.scope_zoom)
+    const int16_t fit = STRIP_LINES*WIDTH/job.w;
+    const int16_t lines = job.h<fit ? job.h : fit;
+    uint16_t *strip = display_strip[display_next_strip];
+    display_next_strip ^= 1;
+    for (int16_t i=0;i<lines;i++)
     {
-      case 0:
-      {
-        // for 60KHz scope 250Hz / pixel
-        switch (radio.mode)
-        {
-          case Radio::LSB:
-          {
-            for (uint32_t x=0;x<10;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::USB:
-          {
-            for (uint32_t x=0;x<10;x++)
-            {
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::CWL:
-          {
-            for (uint32_t x=0;x<6;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::CWU:
-          {
-            for (uint32_t x=0;x<6;x++)
-            {
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::DIGL:
-          {
-            for (uint32_t x=0;x<14;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::DIGU:
-          {
-            for (uint32_t x=0;x<14;x++)
-            {
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-        }
-        break;      
-      }
-      case 1:
-      {
-        // for 30KHz scope 125Hz / pixel
-        switch (radio.mode)
-        {
-          case Radio::LSB:
-          {
-            for (uint32_t x=0;x<20;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::USB:
-          {
-            for (uint32_t x=0;x<20;x++)
-            {
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::CWL:
-          {
-            for (uint32_t x=0;x<12;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::CWU:
-          {
-            for (uint32_t x=0;x<12;x++)
-            {
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::DIGL:
-          {
-            for (uint32_t x=0;x<28;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::DIGU:
-          {
-            for (uint32_t x=0;x<28;x++)
-            {
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-        }
-        break;      
-      }
-      case 2:
-      {
-        // for 15KHz scope 63Hz / pixel
-        switch (radio.mode)
-        {
-          case Radio::LSB:
-          {
-            for (uint32_t x=0;x<40;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::USB:
-          {
-            for (uint32_t x=0;x<40;x++)
-            {
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::CWL:
-          {
-            for (uint32_t x=0;x<20;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::CWU:
-          {
-            for (uint32_t x=0;x<20;x++)
-            {
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::DIGL:
-          {
-            for (uint32_t x=0;x<50;x++)
-            {
-              spr.drawLine(POS_CENTER_LEFT-x,POS_WATER_Y,POS_CENTER_LEFT-x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-          case Radio::DIGU:
-          {
-            for (uint32_t x=0;x<50;x++)
-            {
-              spr.drawLine(POS_CENTER_RIGHT+x,POS_WATER_Y,POS_CENTER_RIGHT+x,POS_WATER_Y+31,BANDWIDTH_SHADE);
-            }
-            break;
-          }
-        }
-        break;      
-      }
+      display_expand(&strip[i*job.w],job.x,job.y+i,job.w);
     }
+    display_staged = {job.x,job.y,job.w,lines,strip};
+    job.y += lines;
+    job.h -= lines;
+    if (job.h==0) display_head++;
+  }
+  display_is_staged = true;
+}
+
+static void display_service(void)
+{
+  // start the staged transfer once the last one has gone,
+  // then stage the one after it while this one is sent,
+  // this never waits for the SPI
+  display_stage();
+  if (!display_is_staged || tft.dmaBusy())
+  {
+    return;
   }
+  const display_job_t &job = display_staged;
+  tft.pushImageDMA(job.x,job.y,job.w,job.h,(uint16_t *)job.pixels);
+  display_is_staged = false;
+  display_stage();
+}
+
+static const boolean display_idle(void)
+{
+  // everything queued is on the display, the sprite and
+  // the waterfall ring can be drawn on again
+  return display_head==display_tail && !display_is_staged && !tft.dmaBusy();
 }
 
 static void show_new_spectrum(void)
 {
-  switch (radio.scope_zoom)
+  // core 1 has mapped the spectrum onto the WIDTH pixels
+  // for the zoom, spectrum_buffer is the row in 8 bit dB
+
+  // auto contrast, the trace and palette start a little
+  // below the noise floor and reach up to the signal level
+  const int32_t lo = max((int32_t)spectrum.NOISE-CONTRAST_MARGIN,(int32_t)0);
+  const int32_t hi = max((int32_t)spectrum.PEAK,lo+CONTRAST_MIN);
+  const int32_t contrast = (32 << 8)/(hi-lo);
+  for (uint32_t x=0;x<WIDTH;x++)
   {
-    case 0:
-    {
-      // this is about 60KHz wide
-      for (uint32_t i=0;i<N_WAVE/4;i++)
-      {
-        uint8_t droplet = spectrum_buffer[i*4];
-        droplet = max(droplet,spectrum_buffer[i*4+1]);
-        droplet = max(droplet,spectrum_buffer[i*4+2]);
-        droplet = max(droplet,spectrum_buffer[i*4+3]);
-        spectrum_buffer[i] = droplet;
-      }
-      static const uint32_t buffer_start = (N_WAVE/4/2-1)-(WIDTH/2-1);
-      for (uint32_t x=0;x<WIDTH;x++)
-      {
-        uint8_t droplet = spectrum_buffer[buffer_start+x];
-        if (droplet>31) droplet = 31;
-        water[wp][x] = droplet;
-      }
-      break;
-    }
-    case 1:
-    {
-      // this is about 30KHz wide
-      for (uint32_t i=0;i<N_WAVE/4;i++) // 0 - 255 (<256)
-      {
-        uint8_t droplet = spectrum_buffer[256+i*2];        // 256, 258, 260,...,766
-        droplet = max(droplet,spectrum_buffer[256+i*2+1]); // 257, 259, 262,...,767
-        spectrum_buffer[i] = droplet;
-      }
-      static const uint32_t buffer_start = (N_WAVE/4/2-1)-(WIDTH/2-1);
-      for (uint32_t x=0;x<WIDTH;x++)
-      {
-        uint8_t droplet = spectrum_buffer[buffer_start+x];
-        if (droplet>31) droplet = 31;
-        water[wp][x] = droplet;
-      }
-      break;
-    }
-    case 2:
-    {
-      // this is about 15KHz wide
-      static const uint32_t buffer_start = (N_WAVE/2-1)-(WIDTH/2-1);
-      for (uint32_t x=0;x<WIDTH;x++)
-      {
-        uint8_t droplet = spectrum_buffer[buffer_start+x];
-        if (droplet>31) droplet = 31;
-        water[wp][x] = droplet;
-      }
-      break;
-    }
+    // 8 bit dB onto the 32 pixel trace and palette
+    const int32_t v = ((spectrum_buffer[x]-lo)*contrast) >> 8;
+    trace[x] = v<0 ? 0 : v>31 ? 31 : v;
+  }
+
+  // colour the new row once, above the last one
+  wp = wp==0 ? WATERFALL_ROWS-1 : wp-1;
+  for (uint32_t x=0;x<WIDTH;x++)
+  {
+    water[wp][x] = __builtin_bswap16(color_map_32[trace[x]]);
   }
 
   // draw the spectrum
   for (uint32_t x=0;x<WIDTH-1;x++)
   {
-    const int32_t v0 = water[wp][x];
-    const int32_t v1 = water[wp][x+1];
+    const int32_t v0 = trace[x];
+    const int32_t v1 = trace[x+1];
     const int32_t x0 = x;
     const int32_t y0 = POS_WATER_Y+31-v0;
     const int32_t x1 = x+1;
     const int32_t y1 = POS_WATER_Y+31-v1;
-    spr.drawLine(x0,y0,x1,y1,TFT_WHITE);
+    spr.drawLine(x0,y0,x1,y1,SPRITE_WHITE);
   }
 
 /*
   for (uint32_t x=0;x<WIDTH;x++)
   {
-    const uint32_t droplet = water[wp][x];
+    const uint32_t droplet = trace[x];
     if (droplet==0) continue;
-    spr.drawFastVLine(x,POS_WATER_Y+31-droplet,droplet,TFT_WHITE);
+    spr.drawFastVLine(x,POS_WATER_Y+31-droplet,droplet,SPRITE_WHITE);
   }
 */
-  // draw the waterfall
-  int32_t r = wp;
-  int32_t y = POS_WATER_Y+32;
-  for (uint32_t i=0;i<WATERFALL_ROWS;i++,y++)
-  {
-    for (uint32_t x=0;x<WIDTH;x++)
-    {
-      const uint16_t c = color_map_32[water[r][x]];
-      spr.drawPixel(x,y,c);
-    }
-    r--;
-    if (r<0) r = WATERFALL_ROWS-1;
-  }
-  wp++;
-  if (wp>=WATERFALL_ROWS) wp = 0;
 }
 
 static void show_old_spectrum(void)
 {
-  int32_t old_wp = wp-1;
-  if (old_wp<0) old_wp = WATERFALL_ROWS-1;
-
   // draw the old spectrum
   for (uint32_t x=0;x<WIDTH-1;x++)
   {
-    const int32_t v0 = water[old_wp][x];
-    const int32_t v1 = water[old_wp][x+1];
+    const int32_t v0 = trace[x];
+    const int32_t v1 = trace[x+1];
     const int32_t x0 = x;
     const int32_t y0 = POS_WATER_Y+31-v0;
     const int32_t x1 = x+1;
     const int32_t y1 = POS_WATER_Y+31-v1;
-    spr.drawLine(x0,y0,x1,y1,TFT_WHITE);
+    spr.drawLine(x0,y0,x1,y1,SPRITE_WHITE);
   }
 /*
   for (uint32_t x=0;x<WIDTH;x++)
   {
-    const uint32_t droplet = water[old_wp][x];
+    const uint32_t droplet = trace[x];
     if (droplet==0) continue;
-    spr.drawFastVLine(x,POS_WATER_Y+31-droplet,droplet,TFT_WHITE);
+    spr.drawFastVLine(x,POS_WATER_Y+31-droplet,droplet,SPRITE_WHITE);
   }
 */
-  // draw the waterfall
-  int32_t r = old_wp;
-  int32_t y = POS_WATER_Y+32;
-  for (uint32_t i=0;i<WATERFALL_ROWS;i++,y++)
-  {
-    for (uint32_t x=0;x<WIDTH;x++)
-    {
-      const uint16_t c = color_map_32[water[r][x]];
-      spr.drawPixel(x,y,c);
-    }
-    r--;
-    if (r<0) r = WATERFALL_ROWS-1;
-  }
+}
+
+static void show_waterfall(void)
+{
+  // the waterfall is not in the sprite, it goes straight
+  // to the display only when a new row has arrived, as the
+  // two runs of the ring either side of the split, newest
+  // row at the top
+  const int16_t top = WATERFALL_ROWS-wp;
+  display_queue(0,POS_WATERFALL_Y,WIDTH,top,water[wp]);
+  display_queue(0,POS_WATERFALL_Y+top,WIDTH,wp,water[0]);
 }
 
 static void show_multifunc(void)
 {
   // show the current multifunction function
-  spr.fillRect(POS_MULTI_X-4,POS_MULTI_Y-5,45,25,multifunc.highlight?TFT_RED:TFT_PURPLE);
+  spr.fillRect(POS_MULTI_X-4,POS_MULTI_Y-5,45,25,multifunc.highlight?SPRITE_RED:SPRITE_PURPLE);
   spr.setTextSize(2);
-  spr.setTextColor(TFT_WHITE);
+  spr.setTextColor(SPRITE_WHITE);
   spr.setCursor(POS_MULTI_X,POS_MULTI_Y);
   const char *sz_func = "XXX";
   switch (multifunc.new_function)
@@ -1084,10 +1069,10 @@ static void show_multifunc_value(void)
   // show the multifunction value
   static const uint32_t message_width = 9*14;
   static const uint32_t pos_message_x = WIDTH/2-message_width/2;
-  spr.fillRect(pos_message_x-1,POS_MULTIVALUE_Y-1,message_width+2,26,TFT_WHITE);
-  spr.fillRect(pos_message_x+1,POS_MULTIVALUE_Y+1,message_width-4,22,TFT_BLACK);
+  spr.fillRect(pos_message_x-1,POS_MULTIVALUE_Y-1,message_width+2,26,SPRITE_WHITE);
+  spr.fillRect(pos_message_x+1,POS_MULTIVALUE_Y+1,message_width-4,22,SPRITE_BLACK);
   spr.setTextSize(2);
-  spr.setTextColor(TFT_WHITE);
+  spr.setTextColor(SPRITE_WHITE);
   spr.setCursor(pos_message_x+8,POS_MULTIVALUE_Y+5);
   switch (multifunc.new_function)
   {
@@ -1145,6 +1130,12 @@ static void show_multifunc_value(void)
         case SCOPE_ZOOM_0:  spr.print("Zoom: 0");  break;
         case SCOPE_ZOOM_1:  spr.print("Zoom: 1");  break;
         case SCOPE_ZOOM_2:  spr.print("Zoom: 2");  break;
+        case SCOPE_ZOOM_3:  spr.print("Zoom: 3");  break;
+        case SCOPE_ZOOM_4:  spr.print("Zoom: 4");  break;
+        case SCOPE_ZOOM_5:  spr.print("Zoom: 5");  break;
+        case SCOPE_OVERLAP_0:  spr.print("Ovlp: 0");  break;
+        case SCOPE_OVERLAP_50: spr.print("Ovlp: 50"); break;
+        case SCOPE_OVERLAP_75: spr.print("Ovlp: 75"); break;
       }
       break;
     }
@@ -1195,10 +1186,10 @@ static void show_message(void)
   {
     static const uint32_t message_width = 9*14;
     static const uint32_t pos_message_x = WIDTH/2-message_width/2;
-    spr.fillRect(pos_message_x,POS_MULTIVALUE_Y,message_width,24,TFT_WHITE);
-    spr.fillRect(pos_message_x+2,POS_MULTIVALUE_Y+2,message_width-4,20,TFT_BLACK);
+    spr.fillRect(pos_message_x,POS_MULTIVALUE_Y,message_width,24,SPRITE_WHITE);
+    spr.fillRect(pos_message_x+2,POS_MULTIVALUE_Y+2,message_width-4,20,SPRITE_BLACK);
     spr.setTextSize(2);
-    spr.setTextColor(TFT_WHITE);
+    spr.setTextColor(SPRITE_WHITE);
     spr.setCursor(pos_message_x+8,POS_MULTIVALUE_Y+5);
     const char *sz_message = "";
     switch (message.message)
@@ -1213,35 +1204,147 @@ static void show_message(void)
   }
 }
 
-static void display_clear(void)
+static void scope_clear(void)
 {
-  spr.fillSprite(TFT_BLACK);
+  spr.fillRect(0,POS_WATER_Y,WIDTH,POS_WATERFALL_Y-POS_WATER_Y,SPRITE_BLACK);
 }
 
-static void display_refresh(void)
+static void scope_refresh(void)
 {
-  spr.pushSprite(0,0);
+  static const rect_t scope = {0,POS_WATER_Y,WIDTH,POS_WATERFALL_Y-POS_WATER_Y};
+  display_queue_sprite(scope);
 }
 
-void loop1(void)                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                  
+static void update_widget(const widget_t widget, const uint32_t value, void (*show)(void))
+{
+  // redraw and push a status panel widget, only if
+  // what it shows has changed since it was last drawn
+  static uint32_t shown[WIDGET_COUNT] =
+  {
+    UINT32_MAX,UINT32_MAX,UINT32_MAX,UINT32_MAX,
+    UINT32_MAX,UINT32_MAX,UINT32_MAX
+  };
+  if (shown[widget]==value)
+  {
+    return;
+  }
+  shown[widget] = value;
+  const rect_t &r = widget_rect[widget];
+  spr.fillRect(r.x,r.y,r.w,r.h,SPRITE_BLACK);
+  show();
+  display_queue_sprite(r);
+}
+
+static void show_status(void)
 {
-  spectrum.process(radio.scope_speed);
+  // each widget with the values that change it
+  const boolean cw = radio.mode==Radio::CWL || radio.mode==Radio::CWU;
+  update_widget(WIDGET_RXTX,radio.txEnabled(),show_rx_tx);
+  update_widget(WIDGET_FREQUENCY,radio.frequency | (radio.isLocked()?0x80000000UL:0UL),show_frequency);
+  update_widget(WIDGET_STEP,radio.tuning_step,show_tuning_step);
+  update_widget(WIDGET_MODE,radio.mode,show_mode);
+  update_widget(WIDGET_METER,meter_value(),show_meter_dial);
+  update_widget(WIDGET_MULTI,multifunc.new_function | (multifunc.highlight?0x100UL:0UL),show_multifunc);
+  update_widget(WIDGET_ATT,radio.attEnabled() | (cw?2UL:0UL) | (multifunc.current_value_wpm << 2),show_attenuator);
+}
 
-  // if the main loop is copying data,
-  // just wait for it to complete
-  mutex_enter_blocking(&spectrum_mutex);
+#ifdef SPECTRUM_PROFILE
+static void show_profile(void)
+{
+  // average time of each spectrum stage in us, two
+  // columns over the waterfall, straight to the display
+  // after each new row, from the last copy core 1 made of
+  // its counts, then ask for the next one
+  static uint32_t average[spectrum.PROFILE_STAGES] = {0};
+  const uint32_t mhz = rp2040.f_cpu()/1000000u;
+  if (spectrum.profileReady())
+  {
+    for (uint32_t s=0;s<spectrum.PROFILE_STAGES;s++)
+    {
+      average[s] = spectrum.profileCopy().average(s)/mhz;
+    }
+    spectrum.requestProfile(false);
+  }
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_WHITE,TFT_BLACK);
+  for (uint32_t s=0;s<spectrum.PROFILE_STAGES;s++)
+  {
+    tft.setCursor((s/5)*(WIDTH/2),POS_WATERFALL_Y+(s%5)*8);
+    tft.print(spectrum.PROFILE_NAMES[s]);
+    tft.print(" ");
+    tft.print(average[s]);
+  }
+}
+#endif
+
+#ifdef SPECTRUM_LATENCY
+static void show_latency(const uint32_t us, const uint32_t busy)
+{
+  // frame published to pixels on the display, and the
+  // core 0 time in the display code for each, every 64 frames
+  static uint32_t count = 0;
+  static uint32_t total = 0;
+  static uint32_t least = UINT32_MAX;
+  static uint32_t most = 0;
+  static uint32_t busy_total = 0;
+  static uint32_t busy_most = 0;
+  total += us;
+  least = min(least,us);
+  most = max(most,us);
+  busy_total += busy;
+  busy_most = max(busy_most,busy);
+  if (++count<64) return;
+  Serial.print("latency us min: ");
+  Serial.print(least);
+  Serial.print(" avg: ");
+  Serial.print(total/count);
+  Serial.print(" max: ");
+  Serial.print(most);
+  Serial.print(" overwritten: ");
+  Serial.println(spectrum.overwritten());
+  Serial.print("display us per frame avg: ");
+  Serial.print(busy_total/count);
+  Serial.print(" max: ");
+  Serial.println(busy_most);
+  count = 0;
+  total = 0;
+  least = UINT32_MAX;
+  most = 0;
+  busy_total = 0;
+  busy_most = 0;
+}
+#endif
+
+void loop1(void)                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                  
+{
+  set_zoom_offset();
+  // start the averaging afresh on a new band or frequency
+  static uint32_t spectrum_frequency = 0;
+  if (radio.frequency!=spectrum_frequency)
+  {
+    spectrum_frequency = radio.frequency;
+    spectrum.resetAverage();
+  }
 
-  // copy spectrum data to spectrum data buffer
-  for (uint32_t i=0;i<N_WAVE;i++)
+  // keep the dB scale referred to the antenna
+  static int32_t spectrum_gain = 0;
+  const int32_t gain = radio.attEnabled() ? ATTENUATOR_GAIN : 0;
+  if (gain!=spectrum_gain)
   {
-    spectrum_data[i] = spectrum.mag[i];
+    spectrum_gain = gain;
+    spectrum.setGain(gain);
   }
+  spectrum.process(radio.scope_speed,radio.scope_overlap,radio.scope_zoom);
 
-  // indicate new data is available
+  // hand the frame to the main loop, this never waits
+  // for it, a frame it has not got round to is replaced
   spectrum.dataReady();
-  
-  // main loop can now use the data
-  mutex_exit(&spectrum_mutex);
+
+  // and wake it up to draw it, the push sends an event
+  // that ends the main loop's __wfe(), with the time for
+  // measuring the latency, if the FIFO is full the
+  // main loop has a notice waiting already
+  rp2040.fifo.push_nb(time_us_32());
 }
 
 void loop(void)
@@ -2020,6 +2123,12 @@ void loop(void)
               case SCOPE_ZOOM_0:  radio.scope_zoom  = 0u; break;
               case SCOPE_ZOOM_1:  radio.scope_zoom  = 1u; break;
               case SCOPE_ZOOM_2:  radio.scope_zoom  = 2u; break;
+              case SCOPE_ZOOM_3:  radio.scope_zoom  = 3u; break;
+              case SCOPE_ZOOM_4:  radio.scope_zoom  = 4u; break;
+              case SCOPE_ZOOM_5:  radio.scope_zoom  = 5u; break;
+              case SCOPE_OVERLAP_0:  radio.scope_overlap = 0u;  break;
+              case SCOPE_OVERLAP_50: radio.scope_overlap = 50u; break;
+              case SCOPE_OVERLAP_75: radio.scope_overlap = 75u; break;
             }
             save_settings();
           }
@@ -2146,7 +2255,13 @@ void loop(void)
                 case SCOPE_SPEED_4: multifunc.new_value_scopeoption = SCOPE_SPEED_3; break;
                 case SCOPE_ZOOM_0:  multifunc.new_value_scopeoption = SCOPE_ZOOM_1;  break;
                 case SCOPE_ZOOM_1: multifunc.new_value_scopeoption  = SCOPE_ZOOM_2;  break;
-                case SCOPE_ZOOM_2: multifunc.new_value_scopeoption  = SCOPE_SPEED_4; break;
+                case SCOPE_ZOOM_2: multifunc.new_value_scopeoption  = SCOPE_ZOOM_3;  break;
+                case SCOPE_ZOOM_3: multifunc.new_value_scopeoption  = SCOPE_ZOOM_4;  break;
+                case SCOPE_ZOOM_4: multifunc.new_value_scopeoption  = SCOPE_ZOOM_5;  break;
+                case SCOPE_ZOOM_5: multifunc.new_value_scopeoption  = SCOPE_OVERLAP_0; break;
+                case SCOPE_OVERLAP_0:  multifunc.new_value_scopeoption = SCOPE_OVERLAP_50; break;
+                case SCOPE_OVERLAP_50: multifunc.new_value_scopeoption = SCOPE_OVERLAP_75; break;
+                case SCOPE_OVERLAP_75: multifunc.new_value_scopeoption = SCOPE_SPEED_4;    break;
               }
               break;
             }
@@ -2240,7 +2355,13 @@ void loop(void)
                 case SCOPE_SPEED_1: multifunc.new_value_scopeoption = SCOPE_SPEED_2; break;
                 case SCOPE_SPEED_2: multifunc.new_value_scopeoption = SCOPE_SPEED_3; break;
                 case SCOPE_SPEED_3: multifunc.new_value_scopeoption = SCOPE_SPEED_4; break;
-                case SCOPE_SPEED_4: multifunc.new_value_scopeoption = SCOPE_ZOOM_2;  break;
+                case SCOPE_SPEED_4: multifunc.new_value_scopeoption = SCOPE_OVERLAP_75; break;
+                case SCOPE_OVERLAP_75: multifunc.new_value_scopeoption = SCOPE_OVERLAP_50; break;
+                case SCOPE_OVERLAP_50: multifunc.new_value_scopeoption = SCOPE_OVERLAP_0;  break;
+                case SCOPE_OVERLAP_0:  multifunc.new_value_scopeoption = SCOPE_ZOOM_5;     break;
+                case SCOPE_ZOOM_5:  multifunc.new_value_scopeoption = SCOPE_ZOOM_4;  break;
+                case SCOPE_ZOOM_4:  multifunc.new_value_scopeoption = SCOPE_ZOOM_3;  break;
+                case SCOPE_ZOOM_3:  multifunc.new_value_scopeoption = SCOPE_ZOOM_2;  break;
                 case SCOPE_ZOOM_2:  multifunc.new_value_scopeoption = SCOPE_ZOOM_1;  break;
                 case SCOPE_ZOOM_1:  multifunc.new_value_scopeoption = SCOPE_ZOOM_0;  break;
                 case SCOPE_ZOOM_0:  multifunc.new_value_scopeoption = SCOPE_SPEED_1; break;
@@ -2364,40 +2485,95 @@ void loop(void)
     }
   }
 
-  display_clear();
-  show_rx_tx();
-  show_mode();
-  show_frequency();
-  show_tuning_step();
-  show_meter_dial();
-  show_multifunc();
-  show_attenuator();
-  show_bandwidth();
-
-  // if we can access the spectrum data then
-  // make a copy of it for display, otherwise
-  // just use the last data set
-  boolean update_spectrum_display = false;
-  static uint32_t mutex_owner;
-  if (mutex_try_enter(&spectrum_mutex,&mutex_owner))
+  // the display goes out by DMA, nothing new is drawn
+  // until everything queued is on it, loop() carries on
+  // with the radio meanwhile
+  DISPLAY_BUSY_MARK(serviced);
+  display_service();
+  DISPLAY_BUSY_ADD(serviced);
+
+#ifdef SPECTRUM_PROFILE
+  // 'p' over USB prints the spectrum profile, 'o' turns
+  // the profile over the waterfall on and off
+  static boolean profile_overlay = false;
+  while (Serial.available())
   {
-    if (spectrum.isDataReady())
+    switch (Serial.read())
     {
-      // copy spectrum_data to spectrum display buffer
-      for (uint32_t i=0;i<N_WAVE;i++)
-      {
-        spectrum_buffer[i] = spectrum_data[i];
-      }
-      update_spectrum_display = true;
+      case 'p': spectrum.profile(Serial); break;
+      case 'o': profile_overlay = !profile_overlay; break;
     }
-    mutex_exit(&spectrum_mutex);
   }
+#endif
+
+  // the status panel and the scope refresh at their own
+  // rates, the status panel every STATUS_INTERVAL but only
+  // the widgets that have changed, the scope as soon as core
+  // 1 says a frame has landed (through the inter-core FIFO)
+  // and every SCOPE_INTERVAL anyway for the overlays
+  // otherwise sleep in __wfe() until an event, core 1 sends
+  // one (SEV) with each push into the FIFO, which is polled
+  // not interrupt driven, and any interrupt (the 1ms radio
+  // timer) is an event too
+  static uint32_t next_status = 0;
+  static uint32_t next_scope = 0;
+  static uint32_t published = 0;
+  static uint32_t sent_published = 0;
+  static boolean new_frame = false;
+  static boolean sent_row = false;
+  uint32_t fifo = 0;
+  while (rp2040.fifo.pop_nb(&fifo))
+  {
+    published = fifo;
+    new_frame = true;
+  }
+  if (!display_idle())
+  {
+    return;
+  }
+  if (sent_row)
+  {
+    // the last new row has landed on the display
+    sent_row = false;
+#ifdef SPECTRUM_LATENCY
+    show_latency(time_us_32()-sent_published,display_busy_us);
+    display_busy_us = 0;
+#endif
+#ifdef SPECTRUM_PROFILE
+    if (profile_overlay) show_profile();
+#endif
+  }
+  const uint32_t now = millis();
+  const boolean status_due = now>=next_status;
+  if (status_due)
+  {
+    next_status = now+STATUS_INTERVAL;
+    DISPLAY_BUSY_MARK(status);
+    show_status();
+    DISPLAY_BUSY_ADD(status);
+  }
+  if (!new_frame && now<next_scope)
+  {
+    if (!status_due) __wfe();
+    return;
+  }
+  next_scope = now+SCOPE_INTERVAL;
+  new_frame = false;
+
+  DISPLAY_BUSY_MARK(drawn);
+  scope_clear();
+  show_bandwidth();
 
-  if (update_spectrum_display)
+  // if there is a new spectrum frame use it in place,
+  // otherwise just use the last data set
+  boolean new_row = false;
+  if (spectrum.isDataReady())
   {
+    spectrum_buffer = spectrum.data();
     // new spectrum display data is avaliable so
     // update the spectrum display
     show_new_spectrum();
+    new_row = true;
   }
   else
   {
@@ -2411,11 +2587,15 @@ void loop(void)
   show_multifunc_value();
   show_message();
 
-  // send the display buffer to the display
-  static uint32_t next_update = 0;
-  if (next_update<=millis())
+  // queue the scope for the display, the waterfall only
+  // moves when there is a new row
+  scope_refresh();
+  if (new_row)
   {
-    next_update = millis()+20;
-    display_refresh();
+    show_waterfall();
+    sent_row = true;
+    sent_published = published;
   }
+  display_service();
+  DISPLAY_BUSY_ADD(drawn);
 }
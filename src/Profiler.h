@@ -0,0 +1,89 @@
+/*
+  Cycle counts for the stages of a pipeline.
+
+  Each stage keeps the least, the most and the total of the
+  cycles recorded against it since the last reset, so the
+  average comes out at any time. Recording is a handful of
+  compares and adds, cheap enough for an interrupt. Another
+  core should read a copy, made with the recording held off.
+
+  Only used when SPECTRUM_PROFILE is defined (Spectrum.h).
+*/
+#ifndef Profiler_h
+#define Profiler_h
+
+#include "Arduino.h"
+
+template <uint32_t STAGES>
+class Profiler
+{
+  public:
+    Profiler(void)
+    {
+      reset();
+    }
+
+    void reset(void)
+    {
+      for (uint32_t s=0;s<STAGES;s++)
+      {
+        _least[s] = UINT32_MAX;
+        _most[s] = 0;
+        _total[s] = 0;
+        _count[s] = 0;
+      }
+    }
+
+    inline void record(const uint32_t stage, const uint32_t cycles)
+    {
+      if (cycles<_least[stage]) _least[stage] = cycles;
+      if (cycles>_most[stage]) _most[stage] = cycles;
+      _total[stage] += cycles;
+      _count[stage]++;
+    }
+
+    const uint32_t least(const uint32_t stage) const
+    {
+      return _count[stage] ? _least[stage] : 0;
+    }
+
+    const uint32_t most(const uint32_t stage) const
+    {
+      return _most[stage];
+    }
+
+    const uint32_t average(const uint32_t stage) const
+    {
+      return _count[stage] ? (uint32_t)(_total[stage]/_count[stage]) : 0;
+    }
+
+    const uint32_t count(const uint32_t stage) const
+    {
+      return _count[stage];
+    }
+
+    void print(Print &out, const char *const names[]) const
+    {
+      // one line per stage, cycles
+      for (uint32_t s=0;s<STAGES;s++)
+      {
+        out.print(names[s]);
+        out.print(" min: ");
+        out.print(least(s));
+        out.print(" avg: ");
+        out.print(average(s));
+        out.print(" max: ");
+        out.print(most(s));
+        out.print(" count: ");
+        out.println(count(s));
+      }
+    }
+
+  private:
+    uint32_t _least[STAGES];
+    uint32_t _most[STAGES];
+    uint64_t _total[STAGES];
+    uint32_t _count[STAGES];
+};
+
+#endif
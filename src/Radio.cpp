@@ -27,6 +27,7 @@ Radio::Radio(
   Radio::band = _band;
   Radio::scope_speed = 1;
   Radio::scope_zoom = 0;
+  Radio::scope_overlap = 0;
   Radio::_i2c_band_error = false;
   Radio::_i2c_filter_error = false;
   //Radio::_i2c_band_error = true;
@@ -46,6 +46,7 @@ class Radio
     uint32_t tuning_step = 0;
     uint32_t scope_speed = 1;
     uint32_t scope_zoom = 0;
+    uint32_t scope_overlap = 0;
     Radio::modes_t mode = Radio::XXX;
     Radio::bands_t band = Radio::BANDXX;
     void init(void);
@@ -92,6 +93,7 @@ class Radio
     static const uint32_t PIN_AGC = 28u;
     static const uint32_t ADC_QSDI = 0u;
     static const uint32_t ADC_QSDQ = 1u;
+    static const uint32_t ADC_AGC = 2u;
     static const uint16_t NUM_BANDS = 5u;
     
     Radio(
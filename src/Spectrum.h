@@ -1,24 +1,232 @@
 #ifndef Spectrum_h
 #define Spectrum_h
 
-#define N_WAVE      1024    /* full length of sinewave[] */
-#define LOG2_N_WAVE 10      /* log2(N_WAVE) */
+// FFT size, any power of 2 from 256 to 4096
+// 512 for a faster waterfall, 2048 for finer resolution
+#define SPECTRUM_POINTS 1024
+
+// uncomment to print DSP cycle counts over USB at start up
+//#define SPECTRUM_BENCHMARK
+
+// uncomment to print the time from a frame being ready to
+// it being on the display over USB
+//#define SPECTRUM_LATENCY
+
+// uncomment to count the cycles each stage of the spectrum
+// takes, sent over USB on request and optionally shown over
+// the waterfall
+//#define SPECTRUM_PROFILE
 
 #include "Arduino.h"
+#include "Capture.h"
+#include "DCBlocker.h"
+#include "HalfBand.h"
+#ifdef SPECTRUM_PROFILE
+#include "Profiler.h"
+#endif
 
+template <uint32_t N>
 class Spectrum
 {
   public:
+    static_assert(N>=256u && N<=4096u && (N & (N-1))==0,"FFT size must be a power of 2 from 256 to 4096");
+    // FFT size
+    static const uint32_t POINTS = N;
+    static const uint32_t LOG2_POINTS = N==256?8:N==512?9:N==1024?10:N==2048?11:12;
+    // I/Q sample rate after decimation
+    static const uint32_t SAMPLE_RATE = Capture::SAMPLE_RATE/4;
+    // default corner of the DC blocker
+    static const uint32_t DC_CORNER = 20u;
+    // default top and span of mag[] in dB, from full scale
+    static const int32_t REFERENCE = -18;
+    static const uint32_t RANGE = 72u;
+    // the whole spectrum spans ZOOM_PIXELS pixels, twice
+    // that at zoom 1 and 2, the middle DISPLAY_PIXELS are
+    // drawn, zoom 0 spreads it over 4/3 of ZOOM_PIXELS so
+    // the edges stay where the half-band filter rejects
+    // aliases
+    // zoom 3 to 5 narrow the span before the FFT (zoom FFT),
+    // decimating by 4, 8 or 16, the FFT output then spans
+    // ZOOM_PIXELS*4 pixels (30, 15 and 7.6Hz per pixel)
+    static const uint32_t ZOOM_PIXELS = 256u;
+    static const uint32_t DISPLAY_PIXELS = 240u;
+    static const uint32_t MAX_ZOOM = 5u;
+    static constexpr uint32_t decimation(const uint32_t zoom)
+    {
+      return zoom<3 ? 1u : 4u << ((zoom>MAX_ZOOM?MAX_ZOOM:zoom)-3);
+    }
+    static constexpr uint32_t pixels(const uint32_t zoom)
+    {
+      // pixels the whole spectrum spans at a zoom level
+      return zoom==0 ? ZOOM_PIXELS*4/3 : zoom<3 ? ZOOM_PIXELS << zoom : ZOOM_PIXELS*4;
+    }
+    // pixels that hz spans at a zoom, rounded, and the Hz
+    // the DISPLAY_PIXELS span
+    static constexpr uint32_t hzToPixels(const uint32_t hz, const uint32_t zoom)
+    {
+      return ((uint64_t)hz*decimation(zoom)*pixels(zoom)+SAMPLE_RATE/2)/SAMPLE_RATE;
+    }
+    static constexpr uint32_t displaySpan(const uint32_t zoom)
+    {
+      return ((uint64_t)SAMPLE_RATE*DISPLAY_PIXELS)/(decimation(zoom)*pixels(zoom));
+    }
+    enum fft_t {FFT_RADIX2, FFT_RADIX4};
     Spectrum(void);
-    void __attribute__((noinline,long_call,section(".time_critical"))) process(uint32_t speed = 4);
+    void begin(void);
+    void setDCCorner(const uint32_t corner);
+    void setFFT(const fft_t fft);
+    void setReference(const int32_t reference, const uint32_t range);
+    void setGain(const int32_t gain);
+    const int32_t dB(const uint8_t value);
+    void setZoom(const uint32_t zoom);
+    void setZoomOffset(const int32_t offset);
+    void resetAverage(void);
+    void __attribute__((noinline,long_call,section(".time_critical"))) process(uint32_t speed = 4, uint32_t overlap = 0, uint32_t zoom = 0);
+    void __attribute__((noinline,long_call,section(".time_critical"))) acquire(const uint16_t *block);
+    // rows of DISPLAY_PIXELS pass from core 1 to core 0
+    // through a triple buffer, dataReady() on core 1,
+    // isDataReady() and data() on core 0
     const boolean isDataReady(void);
     void dataReady(void);
-    uint8_t mag[N_WAVE];
+    const uint8_t *data(void);
+    const uint32_t sequence(void);
+    const uint32_t overwritten(void);
+#ifdef SPECTRUM_BENCHMARK
+    void benchmark(Print &out);
+#endif
+#ifdef SPECTRUM_PROFILE
+    // pipeline stages, decimation includes removing DC as
+    // they are done sample by sample together, the FFT
+    // excludes reordering, capture is waiting for samples
+    enum profile_t
+    {
+      PROFILE_CAPTURE,
+      PROFILE_INTERLEAVE,
+      PROFILE_DECIMATE,
+      PROFILE_WINDOW,
+      PROFILE_REORDER,
+      PROFILE_FFT,
+      PROFILE_MAGNITUDE,
+      PROFILE_LOG,
+      PROFILE_ROW,
+      PROFILE_STAGES
+    };
+    static const char *const PROFILE_NAMES[PROFILE_STAGES];
+    void requestProfile(const bool reset);
+    const boolean profileReady(void);
+    const Profiler<PROFILE_STAGES> &profileCopy(void);
+    void profile(Print &out);
+#endif
+    // 8 bit dB, 0 at reference-range and 255 at reference
+    uint8_t mag[N];
     uint8_t AGC;
+    // noise floor and signal level of the drawn part of
+    // mag[], same scale, for auto contrast and the meter
+    uint8_t NOISE;
+    uint8_t PEAK;
   private:
-    void FFT(int16_t fr[], int16_t fi[], int16_t m);
-    uint32_t _new_refcount;
-    uint32_t _old_refcount;
+    // 512 I/Q pairs per capture block
+    static const uint32_t NRAW = Capture::BLOCK_SIZE/2;
+    // continuous I/Q samples (after decimation) that
+    // frames are taken from, a power of 2 and room
+    // for a frame plus blocks arriving while it is copied
+    static const uint32_t RING_SIZE = N*2>2048u?N*2:2048u;
+    static const uint32_t RING_MASK = RING_SIZE-1;
+    // the log stage looks this many bits (about 6dB each)
+    // below where fixed scaling of the FFT left off
+    static const uint32_t FLOOR_BITS = 3u;
+    // a full scale tone comes out of frame() as 2^15,
+    // 90.3dB of power, in tenths of a dB
+    static const int32_t FULL_SCALE_DB10 = 903;
+    void scale(void);
+    // histogram levels for NOISE and PEAK
+    static const uint32_t LEVELS = 64u;
+    void levels(const bool restart);
+    void __attribute__((noinline,long_call,section(".time_critical"))) row(void);
+    inline const bool needed(const uint32_t bin)
+    {
+      // an FFT bin that is drawn at the current zoom
+      return bin<_low || bin>=N-_high;
+    }
+    void reorder(int16_t fr[], int16_t fi[]);
+    const uint32_t peak(const int16_t fr[], const int16_t fi[]);
+    const int32_t FFT2(int16_t fr[], int16_t fi[]);
+    const int32_t FFT4(int16_t fr[], int16_t fi[]);
+    // zoom FFT filters
+    static const uint32_t CIC_ORDER = 3u;
+    static const uint32_t ZOOM_HISTORY = 32u;
+    inline void downconvert(int32_t re, int32_t im);
+    void __attribute__((noinline,long_call,section(".time_critical"))) window(const uint32_t start);
+    void __attribute__((noinline,long_call,section(".time_critical"))) frame(void);
+    void __attribute__((noinline,long_call,section(".time_critical"))) output(const uint32_t speed);
+    Capture _capture;
+    int16_t _ring_re[RING_SIZE];
+    int16_t _ring_im[RING_SIZE];
+    volatile uint32_t _ring_wr;
+    int16_t _zoom_re[RING_SIZE];
+    int16_t _zoom_im[RING_SIZE];
+    volatile uint32_t _zoom_wr;
+    uint32_t _frame_end;
+    int16_t _re[N];
+    int16_t _im[N];
+    int32_t _magnitude[N];
+    // exponential average of the power in each bin
+    uint32_t _power[N];
+    bool _restart;
+    int32_t _reference;
+    uint32_t _range;
+    int32_t _gain;
+    uint32_t _log_scale;
+    int32_t _log_offset;
+    int32_t _noise;
+    int32_t _peak;
+#ifdef SPECTRUM_PROFILE
+    // recorded on core 1 (stages in the DMA interrupt too),
+    // core 0 only reads the copy core 1 makes on request
+    Profiler<PROFILE_STAGES> _profiler;
+    Profiler<PROFILE_STAGES> _profile_copy;
+    volatile bool _profile_wanted;
+    volatile bool _profile_reset;
+#endif
+    fft_t _fft;
+    uint32_t _first;
+    uint32_t _last;
+    uint32_t _low;
+    uint32_t _high;
+    uint32_t _zoom;
+    uint32_t _decimation;
+    uint32_t _nco_phase;
+    uint32_t _nco_step;
+    uint32_t _cic_count;
+    uint32_t _cic_shift;
+    uint32_t _cic_re[CIC_ORDER];
+    uint32_t _cic_im[CIC_ORDER];
+    uint32_t _comb_re[CIC_ORDER];
+    uint32_t _comb_im[CIC_ORDER];
+    int16_t _zoom_hb_re[ZOOM_HISTORY*2];
+    int16_t _zoom_hb_im[ZOOM_HISTORY*2];
+    uint32_t _zoom_hb_pos;
+    HalfBand _halfband;
+    DCBlocker _dc_re;
+    DCBlocker _dc_im;
+    uint32_t _agc;
+    uint32_t _agc_count;
+    const uint16_t *_pixel_map;
+    uint8_t *_row;
+    uint8_t _frames[3][DISPLAY_PIXELS];
+    volatile uint32_t _sequence[3];
+    volatile uint32_t _ready;
+    volatile uint32_t _reading;
+    uint32_t _write;
+    uint32_t _front;
+    uint32_t _published;
+    volatile uint32_t _taken;
+    volatile uint32_t _overwritten;
 };
 
+#ifdef SPECTRUM_BENCHMARK
+// frame time and RAM for each FFT size
+void spectrum_benchmark(Print &out);
+#endif
+
 #endif
@@ -0,0 +1,166 @@
+// block rotation of the capture, driven by the host stand-in
+// for the ADC and DMA, each block is filled with its sequence
+// number so it is plain which one acquire() hands out
+#include "check.h"
+#include "Capture.h"
+
+static uint16_t sequence = 0;
+
+static void source(uint16_t *block, const uint32_t count, void *context)
+{
+  for (uint32_t i=0;i<count;i++) block[i] = sequence;
+  sequence++;
+}
+
+static uint32_t delivered[8];
+static uint32_t deliveries = 0;
+
+static void callback(const uint16_t *block, void *context)
+{
+  // the callback is handed the block that has just filled
+  CHECK(block[0]==block[Capture::BLOCK_SIZE-1]);
+  if (deliveries<8) delivered[deliveries] = block[0];
+  deliveries++;
+}
+
+static void test_rotation(void)
+{
+  // one block at a time, in order, alternating buffers
+  Capture capture;
+  sequence = 0;
+  capture.setSource(source,NULL);
+  capture.begin();
+  const uint16_t *previous = NULL;
+  for (uint16_t i=0;i<6;i++)
+  {
+    const uint16_t *block = capture.acquire();
+    CHECK(block[0]==i);
+    CHECK(block!=previous);
+    CHECK(capture.release());
+    previous = block;
+  }
+  CHECK(capture.overruns()==0);
+  capture.end();
+}
+
+static void test_skip_to_newest(void)
+{
+  // blocks that completed while nothing was reading are
+  // skipped and counted, the newest is handed out
+  Capture capture;
+  sequence = 0;
+  capture.setSource(source,NULL);
+  capture.begin();
+  capture.fill();
+  capture.fill();
+  capture.fill();
+  const uint16_t *block = capture.acquire();
+  CHECK(block[0]==2);
+  CHECK(capture.overruns()==2);
+  CHECK(capture.release());
+  // and it carries on in order from there
+  block = capture.acquire();
+  CHECK(block[0]==3);
+  CHECK(capture.release());
+  CHECK(capture.overruns()==2);
+  capture.end();
+}
+
+static void test_overwritten(void)
+{
+  // once the other block completes the DMA is back on the
+  // one in use, so a block has to be released within one
+  // block time of landing
+  Capture capture;
+  sequence = 0;
+  capture.setSource(source,NULL);
+  capture.begin();
+  const uint16_t *block = capture.acquire();
+  CHECK(block[0]==0);
+  CHECK(capture.release());
+  block = capture.acquire();
+  CHECK(block[0]==1);
+  capture.fill();
+  CHECK(block[0]==1);
+  CHECK(!capture.release());
+  CHECK(capture.overruns()==1);
+  // the next acquire takes the one that overran it
+  block = capture.acquire();
+  CHECK(block[0]==2);
+  CHECK(capture.release());
+  CHECK(capture.overruns()==1);
+  capture.end();
+}
+
+static void test_late_interrupt(void)
+{
+  // an interrupt held off past the end of the next block
+  // still counts both, and the blocks keep their places
+  Capture capture;
+  sequence = 0;
+  capture.setSource(source,NULL);
+  capture.begin();
+  const uint16_t *first = capture.acquire();
+  CHECK(first[0]==0);
+  CHECK(capture.release());
+  capture.fill(false);
+  capture.fill(false);
+  capture.fill();
+  const uint16_t *block = capture.acquire();
+  CHECK(block[0]==3);
+  CHECK(block==first+Capture::BLOCK_SIZE);
+  CHECK(block[Capture::BLOCK_SIZE-1]==3);
+  CHECK(first[0]==2);
+  CHECK(capture.overruns()==2);
+  CHECK(capture.release());
+  block = capture.acquire();
+  CHECK(block[0]==4);
+  CHECK(block==first);
+  CHECK(capture.release());
+  CHECK(capture.overruns()==2);
+  capture.end();
+}
+
+static void test_callback(void)
+{
+  // every block goes to the callback as it completes
+  Capture capture;
+  sequence = 0;
+  deliveries = 0;
+  capture.setSource(source,NULL);
+  capture.onBlock(callback,NULL);
+  capture.begin();
+  for (uint32_t i=0;i<5;i++) capture.fill();
+  CHECK(deliveries==5);
+  for (uint32_t i=0;i<5;i++) CHECK(delivered[i]==i);
+  // after a late interrupt only the newest is handed over
+  capture.fill(false);
+  capture.fill();
+  CHECK(deliveries==6);
+  CHECK(delivered[5]==6);
+  capture.end();
+}
+
+static void test_no_source(void)
+{
+  // without a source the blocks read as mid scale
+  Capture capture;
+  capture.begin();
+  const uint16_t *block = capture.acquire();
+  CHECK(block[0]==2048u);
+  CHECK(block[Capture::BLOCK_SIZE-1]==2048u);
+  CHECK(capture.release());
+  CHECK(capture.readAux(2)==0);
+  capture.end();
+}
+
+int main(void)
+{
+  test_rotation();
+  test_skip_to_newest();
+  test_overwritten();
+  test_late_interrupt();
+  test_callback();
+  test_no_source();
+  return check_result("capture");
+}
@@ -0,0 +1,20 @@
+/*
+  Minimal checks for the host tests, each failure is
+  reported with its line and main() returns the count.
+*/
+#ifndef check_h
+#define check_h
+
+#include <stdio.h>
+
+static int check_failures = 0;
+
+#define CHECK(c) do { if (!(c)) { printf("%s:%d: %s\n",__FILE__,__LINE__,#c); check_failures++; } } while (0)
+
+static inline int check_result(const char *name)
+{
+  printf("%s: %s\n",name,check_failures ? "FAILED" : "ok");
+  return check_failures;
+}
+
+#endif
@@ -0,0 +1,76 @@
+// the fixed-point DC blocker against the same single pole
+// filter in floating point
+#include <math.h>
+#include "check.h"
+#include "DCBlocker.h"
+
+static const uint32_t SAMPLE_RATE = 125000ul;
+
+static double track(DCBlocker &blocker, const uint32_t shift, int32_t (*input)(const uint32_t), const uint32_t count, const uint32_t settle)
+{
+  // largest difference from the reference once both have settled
+  const double a = 1.0/(double)(1ul << shift);
+  double dc = 0.0;
+  double worst = 0.0;
+  for (uint32_t n=0;n<count;n++)
+  {
+    const int32_t x = input(n);
+    dc += a*((double)x-dc);
+    const double y = (double)x-dc;
+    const int32_t z = blocker.process(x);
+    if (n>=settle) worst = fmax(worst,fabs((double)z-y));
+  }
+  return worst;
+}
+
+static int32_t tone(const uint32_t n)
+{
+  // a tone and a little noise on the mid scale offset
+  return (int32_t)(1500.0+3000.0*sin(n*0.3))+(int32_t)(n%7)-3;
+}
+
+static int32_t step(const uint32_t n)
+{
+  return n<1000 ? 0 : -2047;
+}
+
+static int32_t full_scale(const uint32_t n)
+{
+  // 16 bit samples swinging end to end
+  return (n & 1) ? 32767 : -32768;
+}
+
+int main(void)
+{
+  DCBlocker blocker;
+
+  // the corner is the nearest the shift can get
+  blocker.setCorner(20,SAMPLE_RATE);
+  CHECK(blocker.corner(SAMPLE_RATE)==19);
+  blocker.setCorner(100,SAMPLE_RATE);
+  CHECK(blocker.corner(SAMPLE_RATE)==77);
+  blocker.setCorner(1000000,SAMPLE_RATE);
+  CHECK(blocker.corner(SAMPLE_RATE)==9947);
+
+  // the output is rounded, and the estimate drops up to
+  // 2^-12 each sample which builds up over 2^shift samples
+  for (uint32_t shift=1;shift<=14;shift++)
+  {
+    const double limit = 0.5+ldexp(1.0,shift-12);
+    DCBlocker b;
+    b.setCorner((uint32_t)(SAMPLE_RATE/(2.0*M_PI*(1ul << shift))),SAMPLE_RATE);
+    CHECK(track(b,shift,tone,200000,0)<=limit);
+    b.reset();
+    CHECK(track(b,shift,step,50000,0)<=limit);
+    b.reset();
+    CHECK(track(b,shift,full_scale,50000,0)<=limit);
+  }
+
+  // a constant goes to nothing
+  blocker.setCorner(20,SAMPLE_RATE);
+  int32_t y = 0;
+  for (uint32_t n=0;n<100000;n++) y = blocker.process(2048);
+  CHECK(y==0);
+
+  return check_result("dcblocker");
+}
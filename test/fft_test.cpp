@@ -0,0 +1,259 @@
+// the fixed-point FFTs against a floating point DFT, each
+// result is scaled back by its block floating point exponent
+#include <math.h>
+#include "check.h"
+#define private public
+#include "Spectrum.cpp"
+
+template <uint32_t N>
+struct Reference
+{
+  double re[N];
+  double im[N];
+
+  void transform(const int16_t xr[], const int16_t xi[])
+  {
+    // the DFT scaled by 1/N, as the FFTs scale it
+    for (uint32_t k=0;k<N;k++)
+    {
+      double sr = 0.0;
+      double si = 0.0;
+      for (uint32_t n=0;n<N;n++)
+      {
+        const double a = -2.0*M_PI*(double)((k*n)%N)/N;
+        sr += xr[n]*cos(a)-xi[n]*sin(a);
+        si += xr[n]*sin(a)+xi[n]*cos(a);
+      }
+      re[k] = sr/N;
+      im[k] = si/N;
+    }
+  }
+
+  double snr(const int16_t fr[], const int16_t fi[], const int32_t exponent)
+  {
+    // signal to error ratio in dB over every bin
+    const double scale = ldexp(1.0,exponent-(int32_t)Spectrum<N>::LOG2_POINTS);
+    double signal = 0.0;
+    double error = 0.0;
+    for (uint32_t k=0;k<N;k++)
+    {
+      const double er = fr[k]*scale-re[k];
+      const double ei = fi[k]*scale-im[k];
+      signal += re[k]*re[k]+im[k]*im[k];
+      error += er*er+ei*ei;
+    }
+    return 10.0*log10(signal/fmax(error,1e-30));
+  }
+};
+
+template <uint32_t N>
+static void reference_fft(double re[], double im[])
+{
+  // floating point radix-2 in place, scaled by 1/N, quick
+  // enough to check thousands of frames
+  for (uint32_t i=1,j=0;i<N;i++)
+  {
+    uint32_t bit = N >> 1;
+    for (;j & bit;bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i<j)
+    {
+      const double tr = re[i];
+      re[i] = re[j];
+      re[j] = tr;
+      const double ti = im[i];
+      im[i] = im[j];
+      im[j] = ti;
+    }
+  }
+  for (uint32_t l=1;l<N;l<<=1)
+  {
+    for (uint32_t m=0;m<l;m++)
+    {
+      const double wr = cos(M_PI*m/l);
+      const double wi = -sin(M_PI*m/l);
+      for (uint32_t i=m;i<N;i+=l*2)
+      {
+        const uint32_t j = i+l;
+        const double tr = wr*re[j]-wi*im[j];
+        const double ti = wr*im[j]+wi*re[j];
+        re[j] = re[i]-tr;
+        im[j] = im[i]-ti;
+        re[i] += tr;
+        im[i] += ti;
+      }
+    }
+  }
+  for (uint32_t k=0;k<N;k++)
+  {
+    re[k] /= N;
+    im[k] /= N;
+  }
+}
+
+template <uint32_t N>
+static void test_overflow(const uint32_t frames, const double limit)
+{
+  // 2 to 7 tones whose amplitudes add up to full scale, the
+  // partial sums inside a stage can grow by 1+sqrt(2) per
+  // radix-2 stage and 1+3*sqrt(2) per radix-4 stage, so a
+  // threshold that allows for 2 or 4 times lets them wrap
+  static Spectrum<N> spectrum;
+  static int16_t r2[N], i2[N], r4[N], i4[N];
+  static double rr[N], ri[N];
+  spectrum._low = N/2;
+  spectrum._high = N/2;
+  srand(N+1);
+  double worst2 = 1000.0;
+  double worst4 = 1000.0;
+  for (uint32_t frame=0;frame<frames;frame++)
+  {
+    const uint32_t tones = 2+frame%6;
+    double amplitude[7], bin[7], phase[7];
+    double sum = 0.0;
+    for (uint32_t t=0;t<tones;t++)
+    {
+      amplitude[t] = 1.0+rand()%1000;
+      // on a bin half the time, between bins the rest
+      bin[t] = rand()%N+(frame & 1 ? 0.0 : (rand()%1000)/1000.0);
+      phase[t] = 2.0*M_PI*(rand()%1000)/1000.0;
+      sum += amplitude[t];
+    }
+    for (uint32_t n=0;n<N;n++)
+    {
+      double re = 0.0;
+      double im = 0.0;
+      for (uint32_t t=0;t<tones;t++)
+      {
+        const double a = 2.0*M_PI*bin[t]*n/N+phase[t];
+        re += amplitude[t]*cos(a);
+        im += amplitude[t]*sin(a);
+      }
+      r2[n] = r4[n] = (int16_t)lround(re*32767.0/sum);
+      i2[n] = i4[n] = (int16_t)lround(im*32767.0/sum);
+      rr[n] = r2[n];
+      ri[n] = i2[n];
+    }
+    reference_fft<N>(rr,ri);
+    const int32_t e2 = spectrum.FFT2(r2,i2);
+    const int32_t e4 = spectrum.FFT4(r4,i4);
+    const double s2 = 1.0/ldexp(1.0,Spectrum<N>::LOG2_POINTS-e2);
+    const double s4 = 1.0/ldexp(1.0,Spectrum<N>::LOG2_POINTS-e4);
+    double signal = 0.0;
+    double error2 = 0.0;
+    double error4 = 0.0;
+    for (uint32_t k=0;k<N;k++)
+    {
+      signal += rr[k]*rr[k]+ri[k]*ri[k];
+      error2 += pow(r2[k]*s2-rr[k],2.0)+pow(i2[k]*s2-ri[k],2.0);
+      error4 += pow(r4[k]*s4-rr[k],2.0)+pow(i4[k]*s4-ri[k],2.0);
+    }
+    worst2 = fmin(worst2,10.0*log10(signal/fmax(error2,1e-30)));
+    worst4 = fmin(worst4,10.0*log10(signal/fmax(error4,1e-30)));
+  }
+  printf("%u points, %u multi-tone frames at full scale: worst radix-2 %.1fdB radix-4 %.1fdB\n",N,frames,worst2,worst4);
+  // a wrapped value costs far more than this
+  CHECK(worst2>=limit);
+  CHECK(worst4>=limit);
+}
+
+template <uint32_t N>
+static void test_tone(const double amplitude, const double noise, const double limit)
+{
+  // a complex tone part way between bins, and some noise
+  static Spectrum<N> spectrum;
+  static Reference<N> reference;
+  static int16_t xr[N], xi[N], r2[N], i2[N], r4[N], i4[N];
+  // every bin is needed
+  spectrum._low = N/2;
+  spectrum._high = N/2;
+  srand(N);
+  for (uint32_t n=0;n<N;n++)
+  {
+    const double a = 2.0*M_PI*37.3*n/N;
+    xr[n] = (int16_t)lround(amplitude*cos(a)+noise*(rand()/(double)RAND_MAX-0.5));
+    xi[n] = (int16_t)lround(amplitude*sin(a)+noise*(rand()/(double)RAND_MAX-0.5));
+  }
+  reference.transform(xr,xi);
+  memcpy(r2,xr,sizeof(xr));
+  memcpy(i2,xi,sizeof(xi));
+  memcpy(r4,xr,sizeof(xr));
+  memcpy(i4,xi,sizeof(xi));
+  const int32_t e2 = spectrum.FFT2(r2,i2);
+  const int32_t e4 = spectrum.FFT4(r4,i4);
+  const double snr2 = reference.snr(r2,i2,e2);
+  const double snr4 = reference.snr(r4,i4,e4);
+  printf("%u points, amplitude %g, noise %g: radix-2 %.1fdB radix-4 %.1fdB\n",N,amplitude,noise,snr2,snr4);
+  CHECK(snr2>=limit);
+  CHECK(snr4>=limit);
+}
+
+template <uint32_t N>
+static void test_radix(const double amplitude, const double limit, const double mean)
+{
+  // radix-2 and radix-4 bin for bin on the same frames,
+  // both round each product once, so they only differ by
+  // where the rounding falls and the stages they scale down
+  // in, bins are compared at the larger of the two exponents
+  static Spectrum<N> spectrum;
+  static int16_t r2[N], i2[N], r4[N], i4[N];
+  spectrum._low = N/2;
+  spectrum._high = N/2;
+  srand(N);
+  double worst = 0.0;
+  double total = 0.0;
+  for (uint32_t frame=0;frame<20;frame++)
+  {
+    const double bin = frame*N/41.0+0.3;
+    for (uint32_t n=0;n<N;n++)
+    {
+      const double a = 2.0*M_PI*bin*n/N;
+      r2[n] = r4[n] = (int16_t)lround(amplitude*cos(a)+(rand()%2001-1000)*amplitude/8000.0);
+      i2[n] = i4[n] = (int16_t)lround(amplitude*sin(a)+(rand()%2001-1000)*amplitude/8000.0);
+    }
+    const int32_t e2 = spectrum.FFT2(r2,i2);
+    const int32_t e4 = spectrum.FFT4(r4,i4);
+    const int32_t e = e2>e4 ? e2 : e4;
+    const double s2 = ldexp(1.0,e2-e);
+    const double s4 = ldexp(1.0,e4-e);
+    for (uint32_t k=0;k<N;k++)
+    {
+      const double d = fabs(r2[k]*s2-r4[k]*s4)+fabs(i2[k]*s2-i4[k]*s4);
+      worst = fmax(worst,d);
+      total += d;
+    }
+  }
+  printf("%u points, amplitude %g: radix-2 to radix-4 worst %.1f mean %.2f\n",N,amplitude,worst,total/(20.0*N));
+  CHECK(worst<=limit);
+  CHECK(total/(20.0*N)<=mean);
+}
+
+int main(void)
+{
+  // about 51dB near full scale, a weak signal keeps its
+  // bits until the rounding in the stages catches up with it
+  test_tone<512>(30000.0,0.0,53.0);
+  test_tone<1024>(30000.0,0.0,50.0);
+  test_tone<1024>(8000.0,2000.0,50.0);
+  test_tone<1024>(0.0,2000.0,60.0);
+  test_tone<1024>(100.0,0.0,47.0);
+  test_tone<1024>(10.0,0.0,30.0);
+  test_tone<4096>(30000.0,0.0,43.0);
+
+  // a few counts apart at most, every size, odd powers of 2
+  // start radix-4 with a radix-2 stage, a weak signal has
+  // more bits left to differ in
+  test_radix<256>(8000.0,8,2.0);
+  test_radix<512>(8000.0,8,2.0);
+  test_radix<1024>(8000.0,8,2.0);
+  test_radix<2048>(8000.0,8,2.0);
+  test_radix<4096>(8000.0,8,2.0);
+  test_radix<1024>(30000.0,8,2.0);
+  test_radix<1024>(100.0,16,3.0);
+
+  // no stage wraps, however the tones line up
+  test_overflow<512>(3000,45.0);
+  test_overflow<1024>(3000,45.0);
+  test_overflow<4096>(300,40.0);
+  return check_result("fft");
+}
@@ -0,0 +1,91 @@
+// response of the half-band decimator to complex tones, and
+// how well it keeps what is outside the span off the display
+#include <math.h>
+#include "check.h"
+#include "Spectrum.h"
+
+typedef Spectrum<SPECTRUM_POINTS> Scope;
+
+static const double AMPLITUDE = 1800.0;
+
+// the middle DISPLAY_PIXELS are drawn, of 341 at zoom 0
+// and 512 at zoom 1
+static const double EDGE0 = Scope::SAMPLE_RATE*(Scope::DISPLAY_PIXELS/2.0)/Scope::pixels(0);
+static const double EDGE1 = Scope::SAMPLE_RATE*(Scope::DISPLAY_PIXELS/2.0)/Scope::pixels(1);
+
+static double response(const double hz)
+{
+  // gain in dB for a tone at hz, Q is sampled half an
+  // interleaved sample period after I
+  static HalfBand halfband;
+  static uint16_t block[Capture::BLOCK_SIZE];
+  const double rate = Capture::SAMPLE_RATE/2;
+  double power = 0.0;
+  uint32_t count = 0;
+  halfband.reset();
+  for (uint32_t b=0;b<32;b++)
+  {
+    for (uint32_t n=0;n<HalfBand::PAIRS;n++)
+    {
+      const double t = (b*HalfBand::PAIRS+n)/rate;
+      block[n*2+0] = (uint16_t)lround(2048.0+AMPLITUDE*cos(2.0*M_PI*hz*t));
+      block[n*2+1] = (uint16_t)lround(2048.0+AMPLITUDE*sin(2.0*M_PI*hz*(t+0.5/rate)));
+    }
+    halfband.load(block);
+    // skip the blocks the filter is filling on
+    for (uint32_t n=0;b>1 && n<HalfBand::PAIRS/2;n++)
+    {
+      const double i = halfband.I(n);
+      const double q = halfband.Q(n);
+      power += i*i+q*q;
+      count++;
+    }
+    halfband.next();
+  }
+  // the gain of 4 is 12 bits in and 14 out
+  return 10.0*log10(power/count/(AMPLITUDE*AMPLITUDE*16.0));
+}
+
+static double folded(const double offset)
+{
+  // rejection of what folds onto a display offset, from the
+  // other side of the output rate
+  const double rate = Scope::SAMPLE_RATE;
+  return offset>=0.0 ? response(offset-rate) : response(offset+rate);
+}
+
+int main(void)
+{
+  // pass band
+  for (double hz=0.0;hz<=50000.0;hz+=5000.0)
+  {
+    CHECK(response(hz)>-0.4);
+    CHECK(response(-hz)>-0.4);
+  }
+  CHECK(fabs(response(62500.0)+6.0)<0.1);
+
+  // stop band, 80KHz up to the output rate
+  for (double hz=80000.0;hz<=125000.0;hz+=2500.0)
+  {
+    CHECK(response(hz)<-50.0);
+    CHECK(response(-hz)<-50.0);
+  }
+
+  // the figures given in HalfBand.h, what folds onto the
+  // zoom 0 display is down by 50dB, it would not be over
+  // the last 15KHz below the output rate
+  printf("zoom 0 edge %.0fHz, folded rejection %.1fdB\n",EDGE0,folded(EDGE0));
+  for (double hz=0.0;hz<=EDGE0;hz+=EDGE0/16.0)
+  {
+    CHECK(folded(hz)<-50.0);
+    CHECK(folded(-hz)<-50.0);
+  }
+  CHECK(folded(Scope::SAMPLE_RATE/2.0-3000.0)>-11.0);
+  CHECK(folded(Scope::SAMPLE_RATE/2.0-10000.0)>-40.0);
+
+  // zoom 1 and 2 only show the middle
+  CHECK(folded(EDGE1)<-65.0);
+  CHECK(folded(-EDGE1)<-65.0);
+
+  return check_result("halfband");
+}
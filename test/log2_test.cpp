@@ -0,0 +1,110 @@
+// log2q8() against log2() and against the isqrt() and 4096
+// entry table it replaced, for accuracy and speed
+#include <math.h>
+#include <chrono>
+#include "check.h"
+#define private public
+#include "Spectrum.cpp"
+
+// the table that was replaced, floor(ln(x)*3.7765) of the
+// amplitude, about 2.3dB per step
+static uint8_t old_table[4096];
+
+static uint32_t old_isqrt(uint32_t x)
+{
+  uint32_t r = 0;
+  for (uint32_t b=1u << 30;b;b>>=2)
+  {
+    if (x>=r+b)
+    {
+      x -= r+b;
+      r = (r >> 1)+b;
+    }
+    else
+    {
+      r >>= 1;
+    }
+  }
+  return r;
+}
+
+static uint32_t old_log(const uint32_t power)
+{
+  const uint32_t a = old_isqrt(power);
+  return a>4095 ? 31 : old_table[a];
+}
+
+static uint32_t new_log(const uint32_t power)
+{
+  // log2q8() on the old scale, ln(2)*3.7765/2 steps per bit
+  return (log2q8(power)*42888u) >> 23;
+}
+
+template <uint32_t (*F)(const uint32_t)>
+static double time_ns(const uint32_t values[], const uint32_t count)
+{
+  volatile uint32_t sink = 0;
+  const auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t r=0;r<100;r++)
+  {
+    for (uint32_t i=0;i<count;i++) sink += F(values[i]);
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double,std::nano>(t1-t0).count()/(100.0*count);
+}
+
+int main(void)
+{
+  for (uint32_t x=1;x<4096;x++)
+  {
+    const int32_t l = (int32_t)floor(log((double)x)*3.7765);
+    old_table[x] = l>31 ? 31 : l;
+  }
+
+  // within 0.013 of log2() (0.04dB of power) for any value
+  double worst = 0.0;
+  for (uint64_t p=2;p<(1ull << 32);p+=1+p/997)
+  {
+    worst = fmax(worst,fabs(log2q8((uint32_t)p)/256.0-log2((double)p)));
+  }
+  printf("log2q8 worst error %.4f (%.3fdB)\n",worst,worst*3.0103);
+  CHECK(worst<0.013);
+  CHECK(log2q8(0)==0);
+  CHECK(log2q8(1)==0);
+  CHECK(log2q8(UINT32_MAX)==(31u << 8)+255u);
+
+  // on the old 2.3dB steps they agree apart from the odd
+  // value right on a step, where the old one could be out
+  // by the isqrt() rounding down
+  uint32_t differ = 0;
+  uint32_t furthest = 0;
+  for (uint32_t a=1;a<4096;a++)
+  {
+    const uint32_t o = old_log(a*a);
+    const uint32_t n = new_log(a*a);
+    const uint32_t d = o>n ? o-n : n-o;
+    if (d) differ++;
+    furthest = d>furthest ? d : furthest;
+  }
+  printf("old steps, amplitudes 1 to 4095: %u differ, by at most %u\n",differ,furthest);
+  CHECK(differ<=20);
+  CHECK(furthest<=1);
+
+  // speed on the host only, this says nothing exact about
+  // the RP2040 (where CLZ is a ROM routine) beyond the order
+  static uint32_t values[1 << 16];
+  uint32_t seed = 1;
+  for (uint32_t i=0;i<(1u << 16);i++)
+  {
+    seed = seed*1664525u+1013904223u;
+    values[i] = seed >> (seed & 31);
+  }
+  const double old_ns = time_ns<old_log>(values,1u << 16);
+  const double new_ns = time_ns<new_log>(values,1u << 16);
+  printf("host ns per value: isqrt+table %.2f log2q8 %.2f, tables %u and %u bytes\n",
+    old_ns,new_ns,(uint32_t)sizeof(old_table),(uint32_t)sizeof(log2_table));
+  CHECK(new_ns<old_ns);
+  CHECK(sizeof(log2_table)==64);
+
+  return check_result("log2");
+}
@@ -0,0 +1,61 @@
+/*
+  Just enough of the Arduino and arduino-pico API for the
+  signal processing to build on a host, the cycle counter is
+  the host clock in nanoseconds.
+*/
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PI 3.1415926535897932384626433832795
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+#define __not_in_flash_func(f) f
+
+template <class A, class B> static inline auto min(A a, B b) -> decltype(a<b?a:b) { return a<b?a:b; }
+template <class A, class B> static inline auto max(A a, B b) -> decltype(a<b?a:b) { return a>b?a:b; }
+
+static inline uint64_t host_ns(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC,&t);
+  return (uint64_t)t.tv_sec*1000000000ull+t.tv_nsec;
+}
+
+static inline uint32_t time_us_32(void)
+{
+  return (uint32_t)(host_ns()/1000u);
+}
+
+static inline void tight_loop_contents(void) {}
+
+class Print
+{
+  public:
+    size_t print(const char *s) { return ::printf("%s",s); }
+    size_t print(const uint32_t n) { return ::printf("%u",(unsigned)n); }
+    size_t print(const int32_t n) { return ::printf("%d",(int)n); }
+    size_t println(const char *s = "") { return ::printf("%s\n",s); }
+    size_t println(const uint32_t n) { return ::printf("%u\n",(unsigned)n); }
+    size_t println(const int32_t n) { return ::printf("%d\n",(int)n); }
+};
+
+class RP2040
+{
+  public:
+    uint32_t getCycleCount(void) { return (uint32_t)host_ns(); }
+    uint32_t f_cpu(void) { return 1000000000ul; }
+};
+
+inline RP2040 rp2040;
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef Wire_h
+#define Wire_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+class TwoWire
+{
+};
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef hardware_sync_h
+#define hardware_sync_h
+
+#include <stdint.h>
+
+static inline uint32_t save_and_disable_interrupts(void) { return 0; }
+static inline void restore_interrupts(const uint32_t status) { (void)status; }
+static inline void __dmb(void) { __sync_synchronize(); }
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef SI5351_H_
+#define SI5351_H_
+
+#include <stdint.h>
+
+#define SI5351_CRYSTAL_LOAD_0PF 0
+enum si5351_clock_source {SI5351_CLK_SRC_XTAL, SI5351_CLK_SRC_CLKIN};
+
+class Si5351
+{
+};
+
+#endif
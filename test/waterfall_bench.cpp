@@ -0,0 +1,136 @@
+// host model of the three ways the waterfall has been drawn,
+// the SPI is left out, only the work on the core is timed
+// - drawPixel() of every pixel into the sprite every frame
+// - a 5 bit index ring coloured a line at a time every frame
+// - a ring of coloured rows, one new row coloured a frame and
+//   the ring sent as the two runs either side of the split
+// the three have to put the same picture on the display
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include "check.h"
+
+static const uint32_t WIDTH = 240;
+static const uint32_t ROWS = 41;
+static const uint32_t FRAMES = 20000;
+
+static uint16_t color_map_32[32];
+
+// the display, written in order from the top of the window
+static uint16_t display[ROWS*WIDTH];
+static uint32_t display_at;
+
+static void __attribute__((noinline)) push_pixels(const uint16_t *pixels, const uint32_t count)
+{
+  memcpy(&display[display_at],pixels,count*sizeof(pixels[0]));
+  display_at += count;
+}
+
+static void __attribute__((noinline)) draw_pixel(const int32_t x, const int32_t y, const uint16_t color)
+{
+  // clip, swap to the order the display wants and store,
+  // as the sprite does
+  if (x<0 || y<0 || x>=(int32_t)WIDTH || y>=(int32_t)ROWS) return;
+  display[x+y*WIDTH] = __builtin_bswap16(color);
+}
+
+static uint8_t indices[ROWS][WIDTH];
+static uint16_t water[ROWS][WIDTH];
+static uint32_t wp;
+
+static void frame_pixels(const uint8_t *trace)
+{
+  for (uint32_t x=0;x<WIDTH;x++) indices[wp][x] = trace[x];
+  int32_t r = wp;
+  for (uint32_t y=0;y<ROWS;y++)
+  {
+    for (uint32_t x=0;x<WIDTH;x++) draw_pixel(x,y,color_map_32[indices[r][x]]);
+    if (--r<0) r = ROWS-1;
+  }
+  if (++wp>=ROWS) wp = 0;
+}
+
+static void frame_lines(const uint8_t *trace)
+{
+  static uint16_t line[WIDTH];
+  for (uint32_t x=0;x<WIDTH;x++) indices[wp][x] = trace[x];
+  int32_t r = wp;
+  display_at = 0;
+  for (uint32_t y=0;y<ROWS;y++)
+  {
+    for (uint32_t x=0;x<WIDTH;x++) line[x] = __builtin_bswap16(color_map_32[indices[r][x]]);
+    push_pixels(line,WIDTH);
+    if (--r<0) r = ROWS-1;
+  }
+  if (++wp>=ROWS) wp = 0;
+}
+
+static void frame_ring(const uint8_t *trace)
+{
+  wp = wp==0 ? ROWS-1 : wp-1;
+  for (uint32_t x=0;x<WIDTH;x++) water[wp][x] = __builtin_bswap16(color_map_32[trace[x]]);
+  display_at = 0;
+  push_pixels(water[wp],(ROWS-wp)*WIDTH);
+  push_pixels(water[0],wp*WIDTH);
+}
+
+static void next_trace(uint8_t *trace, const uint32_t frame)
+{
+  for (uint32_t x=0;x<WIDTH;x++) trace[x] = (x*7+frame*(x | 1)) & 31;
+}
+
+static void render(void (*frame)(const uint8_t *), const uint32_t frames, uint16_t *picture)
+{
+  // the picture after a number of rows from a clear start
+  uint8_t trace[WIDTH];
+  memset(indices,0,sizeof(indices));
+  memset(water,0,sizeof(water));
+  memset(display,0,sizeof(display));
+  wp = 0;
+  for (uint32_t f=0;f<frames;f++)
+  {
+    next_trace(trace,f);
+    frame(trace);
+  }
+  memcpy(picture,display,sizeof(display));
+}
+
+static double time_us(void (*frame)(const uint8_t *))
+{
+  uint8_t trace[WIDTH];
+  next_trace(trace,0);
+  const auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t f=0;f<FRAMES;f++)
+  {
+    trace[f%WIDTH]++;
+    trace[f%WIDTH] &= 31;
+    frame(trace);
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double,std::micro>(t1-t0).count()/FRAMES;
+}
+
+int main(void)
+{
+  for (uint32_t i=0;i<32;i++) color_map_32[i] = i*2047;
+
+  // the same picture, part way round the ring and after
+  // it has wrapped a few times
+  static uint16_t pixels[ROWS*WIDTH], lines[ROWS*WIDTH], ring[ROWS*WIDTH];
+  static const uint32_t frames[] = {1,17,ROWS,ROWS+1,3*ROWS+5};
+  for (uint32_t i=0;i<sizeof(frames)/sizeof(frames[0]);i++)
+  {
+    render(frame_pixels,frames[i],pixels);
+    render(frame_lines,frames[i],lines);
+    render(frame_ring,frames[i],ring);
+    CHECK(memcmp(pixels,lines,sizeof(pixels))==0);
+    CHECK(memcmp(pixels,ring,sizeof(pixels))==0);
+  }
+
+  printf("waterfall host us per frame, SPI not included:\n");
+  printf("  drawPixel every pixel:  %.2f\n",time_us(frame_pixels));
+  printf("  colour a line a row:    %.2f\n",time_us(frame_lines));
+  printf("  coloured ring:          %.2f\n",time_us(frame_ring));
+
+  return check_result("waterfall");
+}
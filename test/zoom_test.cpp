@@ -0,0 +1,94 @@
+// a tone through the capture half-band, the NCO, the CIC and
+// the zoom half-band, and where it lands on the display
+#include <math.h>
+#include "check.h"
+#define private public
+#include "Spectrum.cpp"
+
+typedef Spectrum<SPECTRUM_POINTS> Scope;
+
+static const double AMPLITUDE = 1800.0;
+
+static Scope spectrum;
+
+static uint32_t peak(const uint32_t zoom, const int32_t offset, const double hz, double *level)
+{
+  // the display index (in mag[]) with the most of a tone at
+  // hz from the tuned frequency, as the I/Q ADC sees it,
+  // Q is sampled half an interleaved sample period after I
+  static uint16_t block[Capture::BLOCK_SIZE];
+  const double rate = Capture::SAMPLE_RATE/2;
+  spectrum.setZoom(0);
+  spectrum.setZoom(zoom);
+  spectrum.setZoomOffset(offset);
+  spectrum._nco_phase = 0;
+  spectrum._halfband.reset();
+  spectrum._dc_re.reset();
+  spectrum._dc_im.reset();
+  // enough blocks for a frame after the filters have filled,
+  // each block is PAIRS/2 samples at the FFT input
+  const uint32_t blocks = (Scope::POINTS/(HalfBand::PAIRS/2)+4)*Scope::decimation(zoom);
+  for (uint32_t b=0;b<blocks;b++)
+  {
+    for (uint32_t n=0;n<HalfBand::PAIRS;n++)
+    {
+      const double t = (b*HalfBand::PAIRS+n)/rate;
+      block[n*2+0] = (uint16_t)lround(2048.0+AMPLITUDE*cos(2.0*M_PI*hz*t));
+      block[n*2+1] = (uint16_t)lround(2048.0+AMPLITUDE*sin(2.0*M_PI*hz*(t+0.5/rate)));
+    }
+    spectrum.acquire(block);
+  }
+  spectrum._frame_end = spectrum._zoom_wr;
+  memset(spectrum._magnitude,0,sizeof(spectrum._magnitude));
+  spectrum.frame();
+  uint32_t best = spectrum._first;
+  for (uint32_t i=spectrum._first;i<spectrum._last;i++)
+  {
+    if (spectrum._magnitude[i]>spectrum._magnitude[best]) best = i;
+  }
+  if (level) *level = 20.0*log10(fmax(spectrum._magnitude[best],1.0));
+  return best;
+}
+
+static int32_t expected(const uint32_t zoom, const int32_t offset, const double hz)
+{
+  // positive I/Q frequencies are left of the centre
+  const double bin = Scope::SAMPLE_RATE/(double)Scope::decimation(zoom)/Scope::POINTS;
+  return Scope::POINTS/2-1-(int32_t)lround((hz-offset)/bin);
+}
+
+static void test_position(const uint32_t zoom, const int32_t offset, const double hz)
+{
+  const uint32_t p = peak(zoom,offset,hz,NULL);
+  printf("zoom %u offset %dHz, tone at %gHz: bin %u, expected %d\n",zoom,offset,hz,p,expected(zoom,offset,hz));
+  CHECK(abs((int32_t)p-expected(zoom,offset,hz))<=1);
+}
+
+int main(void)
+{
+  // every zoom FFT level, centred on the tuned frequency
+  // and on the middle of an LSB or USB passband
+  for (uint32_t zoom=3;zoom<=Scope::MAX_ZOOM;zoom++)
+  {
+    test_position(zoom,0,300.0);
+    test_position(zoom,0,-300.0);
+    test_position(zoom,1250,1250.0);
+    test_position(zoom,1250,1600.0);
+    test_position(zoom,-1250,-1250.0);
+    test_position(zoom,-1250,-700.0);
+  }
+
+  // a tone at the offset is in the middle of the drawn span
+  const uint32_t middle = Scope::POINTS/2-1;
+  CHECK(peak(4,-1250,-1250.0,NULL)==middle);
+
+  // the CIC and the zoom half-band keep a tone well outside
+  // the span off the display
+  double inside, outside;
+  peak(3,0,1000.0,&inside);
+  peak(3,0,30000.0,&outside);
+  printf("zoom 3, tone 30KHz out: %.1fdB below one inside\n",inside-outside);
+  CHECK(inside-outside>40.0);
+
+  return check_result("zoom");
+}